@@ -6,6 +6,8 @@ meta:
 	ADDON_URL = https://github.com/tettou771/ofxIME
 
 common:
+	# uncomment to enable ofxIME::getStats() instrumentation
+	# ADDON_CFLAGS = -DOFXIME_ENABLE_STATS=1
 
 osx:
 	ADDON_LDFLAGS = -framework Carbon
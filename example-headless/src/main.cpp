@@ -0,0 +1,18 @@
+#include "ofMain.h"
+#include "ofAppNoWindow.h"
+#include "ofApp.h"
+
+// GPUのないCIで動かす描画テスト
+// 失敗したレイアウトがあれば終了コード1で終わる
+//   ./example-headless                    ゴールデンイメージと比べる
+//   ./example-headless --update-goldens   ゴールデンイメージを作り直す
+int main(int argc, char *argv[]) {
+    auto app = std::make_shared<ofApp>();
+    for (int i = 1; i < argc; ++i) {
+        if (string(argv[i]) == "--update-goldens") app->updateGoldens = true;
+    }
+
+    auto window = std::make_shared<ofAppNoWindow>();
+    ofSetupOpenGL(window, 640, 240, OF_WINDOW);
+    return ofRunApp(app);
+}
@@ -0,0 +1,57 @@
+#include "ofApp.h"
+
+void ofApp::setup() {
+    ofxIMESoftwareCanvas::setUpdateGoldens(updateGoldens);
+
+    // フォントはbin/dataに同梱（環境のフォントで画素が変わらないように）
+    canvas.allocate(320, 160);
+    if (!font.load("Lato-Regular.ttf", 20)) {
+        ofLogError("example-headless") << "failed to load Lato-Regular.ttf";
+        failures++;
+        return;
+    }
+    font.setTarget(&canvas);
+    ime.setFont(&font);
+    ime.setCursorBlink(false);
+    ime.enable();
+
+    // キャレット
+    ime.setString("hello\nworld");
+    ime.setCursor(1, 3);
+    check("caret", 4, 10, 1, 10);
+
+    // 未確定文字列の下線（選択中の文節は太い下線）
+    ime.setString("typed ");
+    ime.setCursor(0, 6);
+    ime.setMarkedTextFromOS(U"henkan", 0, 3);
+    check("composition", 4, 11, 2, 12);
+
+    // 変換候補の一覧
+    ime.setCandidates({U"Henkan", U"HENKAN", U"henkan"}, 1);
+    check("candidates", 7, 29, 3, 30);
+
+    ime.clearCandidates();
+    ime.unmarkText();
+}
+
+void ofApp::update() {
+    ofExit(failures > 0 ? 1 : 0);
+}
+
+void ofApp::check(const string &name, size_t drawCalls, size_t glyphs, size_t quads, size_t bytesTranscoded) {
+    canvas.begin(ofColor(255));
+    ime.draw(10, 30);
+
+    // 画素は環境のFreeTypeの違いを少しだけ許す
+    size_t diff = canvas.compareToGolden(ofToDataPath("golden/" + name + ".png"), 8);
+    auto &counts = canvas.getCounts();
+    bool ok = diff == 0 && counts.drawCalls == drawCalls && counts.glyphs == glyphs &&
+              counts.quads == quads && counts.bytesTranscoded == bytesTranscoded;
+    ofLog(ok ? OF_LOG_NOTICE : OF_LOG_ERROR) << name << (ok ? " ok" : " FAILED")
+        << ": diff " << diff
+        << ", draw calls " << counts.drawCalls << " (" << drawCalls << ")"
+        << ", glyphs " << counts.glyphs << " (" << glyphs << ")"
+        << ", quads " << counts.quads << " (" << quads << ")"
+        << ", bytes " << counts.bytesTranscoded << " (" << bytesTranscoded << ")";
+    if (!ok) failures++;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ofxIME.h"
+#include "ofxIMESoftwareFont.h"
+
+class ofApp : public ofBaseApp {
+public:
+    void setup();
+    void update();
+
+    bool updateGoldens = false;     // trueならゴールデンイメージを書き出す
+
+private:
+    // 1フレーム描いて、ゴールデンイメージと1フレーム分の回数を確かめる
+    void check(const string &name, size_t drawCalls, size_t glyphs, size_t quads, size_t bytesTranscoded);
+
+    ofxIMESoftwareCanvas canvas;
+    ofxIMESoftwareFont font;
+    ofxIME<ofxIMESoftwareFont> ime;
+    int failures = 0;
+};
@@ -4,28 +4,18 @@ void ofApp::setup() {
     ofSetWindowTitle("ofxIME Example");
     ofBackground(40);
 
-    // フォントの設定
+    // フォントの設定（使った文字だけを遅延でラスタライズする）
     int fontSize = 24;
-    ofTrueTypeFontSettings settings("/System/Library/Fonts/ヒラギノ角ゴシック W3.ttc", fontSize);
-    settings.addRanges(ofAlphabet::Latin);
-    settings.addRanges(ofAlphabet::Japanese);
-    settings.addRange(ofUnicode::KatakanaHalfAndFullwidthForms);
-    settings.addRange(ofUnicode::range{0x3000, 0x303F});
-    font.load(settings);
+    font.load("/System/Library/Fonts/ヒラギノ角ゴシック W3.ttc", fontSize);
 
     // 説明用の小さいフォント
-    ofTrueTypeFontSettings smallSettings("/System/Library/Fonts/ヒラギノ角ゴシック W3.ttc", round(fontSize * 0.6));
-    smallSettings.addRanges(ofAlphabet::Latin);
-    smallSettings.addRanges(ofAlphabet::Japanese);
-    smallSettings.addRange(ofUnicode::KatakanaHalfAndFullwidthForms);
-    smallSettings.addRange(ofUnicode::range{0x3000, 0x303F});
-    smallFont.load(smallSettings);
-
-    // IMEにも同じフォントを設定
+    smallFont.load("/System/Library/Fonts/ヒラギノ角ゴシック W3.ttc", round(fontSize * 0.6));
+
+    // IMEにも同じフォントを設定（レジストリで共有し、バックグラウンドで読み込む）
 #ifdef TARGET_OS_MAC
-    ime.setFont("/System/Library/Fonts/ヒラギノ角ゴシック W3.ttc", fontSize);
+    ime.setSharedFont("/System/Library/Fonts/ヒラギノ角ゴシック W3.ttc", fontSize);
 #else
-    ime.setFont("C:\\Windows\\Fonts\\meiryo.ttc", fontSize);
+    ime.setSharedFont("C:\\Windows\\Fonts\\meiryo.ttc", fontSize);
 #endif
 
     // ボタン領域の設定
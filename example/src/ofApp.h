@@ -2,6 +2,7 @@
 
 #include "ofMain.h"
 #include "ofxIME.h"
+#include "ofxIMELazyFont.h"
 
 class ofApp : public ofBaseApp {
 public:
@@ -11,9 +12,9 @@ public:
     void keyPressed(int key);
     void mousePressed(int x, int y, int button);
 
-    ofxIME ime;
-    ofTrueTypeFont font;       // 日本語表示用フォント
-    ofTrueTypeFont smallFont;  // 説明用の小さいフォント
+    ofxIME<ofxIMELazyFont> ime;
+    ofxIMELazyFont font;       // 日本語表示用フォント
+    ofxIMELazyFont smallFont;  // 説明用の小さいフォント
     vector<string> confirmedTexts;  // 確定済みテキストの履歴
     ofRectangle buttonRect;     // 送信ボタンの領域
     ofRectangle inputAreaRect;  // 入力エリアの領域
@@ -1,4 +1,74 @@
 #include "ofxIME.h"
+#include "ofxIMEThreadPool.h"
+
+namespace {
+    // Moves a position on a hunk's line through it. One inside the replaced
+    // run moves in proportion to the run
+    int mapThroughHunk(int p, const ofxIMEEdit::Hunk &h) {
+        int k = p - h.pos;
+        if (k <= 0) return p;
+        int inserted = (int)h.text.length();
+        if (k >= h.erased) return p + inserted - h.erased;
+        return h.pos + k * inserted / h.erased;
+    }
+
+    // Moves a position through an edit. With stayAtInsert, one exactly where
+    // text was inserted stays before it
+    void mapThroughEdit(int &l, int &p, const ofxIMEEdit &e, bool stayAtInsert) {
+        if (e.type == ofxIMEEdit::Replace) {
+            const ofxIMEEdit::Hunk *end = e.hunks + e.numHunks;
+            const ofxIMEEdit::Hunk *h = std::lower_bound(e.hunks, end, l,
+                [](const ofxIMEEdit::Hunk &hunk, int key) { return hunk.line < key; });
+            if (h != end && h->line == l) p = mapThroughHunk(p, *h);
+            return;
+        }
+        bool after = l > e.line || (l == e.line && p > e.pos);
+        bool at = l == e.line && p == e.pos;
+        if (e.type == ofxIMEEdit::Insert) {
+            if (!after && !(at && !stayAtInsert)) return;
+            if (l == e.line) {
+                p = e.endPos + (p - e.pos);
+                l = e.endLine;
+            }
+            else {
+                l += e.endLine - e.line;
+            }
+        }
+        else if (e.type == ofxIMEEdit::Erase) {
+            if (!after) return;
+            if (l < e.endLine || (l == e.endLine && p < e.endPos)) {
+                l = e.line;
+                p = e.pos;
+            }
+            else if (l == e.endLine) {
+                p = e.pos + (p - e.endPos);
+                l = e.line;
+            }
+            else {
+                l -= e.endLine - e.line;
+            }
+        }
+    }
+
+    // Folds CRLF and lone CR into '\n' in place. afterCR carries a CR that
+    // ended one piece over to the next piece of the same text
+    void foldLineBreaks(u32string &str, bool &afterCR) {
+        size_t n = 0;
+        for (char32_t c : str) {
+            if (c == U'\n' && afterCR) {
+                afterCR = false;
+                continue;
+            }
+            afterCR = c == U'\r';
+            str[n++] = afterCR ? U'\n' : c;
+        }
+        str.resize(n);
+    }
+}
+
+ofxIMEBase::~ofxIMEBase() {
+    cancelPaste();
+}
 
 void ofxIMEBase::enable() {
     if (enabled) return;
@@ -29,7 +99,7 @@ void ofxIMEBase::clear() {
     markedSelectedLocation = 0;
     markedSelectedLength = 0;
     line.clear();
-    line.push_back(U"");
+    line.emplace_back();
     candidates.clear();
     candidateSelectedIndex = 0;
     movingY = 0;
@@ -40,9 +110,476 @@ void ofxIMEBase::clear() {
     if (state == Composing) {
         state = Kana;
     }
+#if OFXIME_BUILTIN_COMPOSER
+    composer.reset();
+    conversion.cancel();
+#endif
+
+    ofxIMEEdit e;
+    e.type = ofxIMEEdit::Reset;
+    notifyEdit(e);
 }
 
+void ofxIMEBase::setCursor(int l, int p) {
+    cursorLine = ofClamp(l, 0, (int)line.size() - 1);
+    cursorPos = ofClamp(p, 0, (int)line[cursorLine].length());
+    cursorBlinkOffsetTime = ofGetElapsedTimef();
+}
+
+void ofxIMEBase::insertAt(int l, int p, std::u32string_view str) {
+    setCursor(l, p);
+    insertLines(str);
+}
+
+void ofxIMEBase::eraseRange(int beginLine, int beginPos, int endLine, int endPos) {
+    selectBegin = TextSelectPos(beginLine, beginPos);
+    selectEnd = TextSelectPos(endLine, endPos);
+    deleteSelected();
+}
+
+int ofxIMEBase::getOffset(int l, int p) const {
+    l = ofClamp(l, 0, (int)line.size() - 1);
+    p = ofClamp(p, 0, (int)line[l].length());
+    return (int)getOffsetIndex().getLineStart(l, ofxIMEOffsetIndex::UTF32) + p;
+}
+
+const ofxIMEOffsetIndex &ofxIMEBase::getOffsetIndex() const {
+    if (!offsetIndex.isBuilt()) offsetIndex.build(line);
+    return offsetIndex;
+}
+
+size_t ofxIMEBase::getOffset(int l, int p, ofxIMEOffsetIndex::Unit unit) const {
+    const ofxIMEOffsetIndex &index = getOffsetIndex();
+    l = ofClamp(l, 0, (int)line.size() - 1);
+    p = ofClamp(p, 0, (int)line[l].length());
+    return index.getLineStart(l, unit) +
+        ofxIMEOffsetIndex::convert(line[l], index.getLine(l), p, ofxIMEOffsetIndex::UTF32, unit);
+}
+
+void ofxIMEBase::getPosition(size_t offset, ofxIMEOffsetIndex::Unit unit, int &l, int &p) const {
+    const ofxIMEOffsetIndex &index = getOffsetIndex();
+    size_t start;
+    l = index.findLine(offset, unit, start);
+    p = (int)ofxIMEOffsetIndex::convert(line[l], index.getLine(l), offset - start, unit, ofxIMEOffsetIndex::UTF32);
+}
+
+size_t ofxIMEBase::convertOffset(size_t offset, ofxIMEOffsetIndex::Unit from, ofxIMEOffsetIndex::Unit to) const {
+    int l, p;
+    getPosition(offset, from, l, p);
+    return getOffset(l, p, to);
+}
+
+void ofxIMEBase::getSelectionOffsets(ofxIMEOffsetIndex::Unit unit, size_t &begin, size_t &end) const {
+    int bl, bp, el, ep;
+    if (selectBegin != selectEnd) {
+        tie(bl, bp) = std::min(selectBegin, selectEnd);
+        tie(el, ep) = std::max(selectBegin, selectEnd);
+    }
+    else {
+        bl = el = cursorLine;
+        bp = ep = cursorPos;
+    }
+    begin = getOffset(bl, bp, unit);
+    end = getOffset(el, ep, unit);
+}
+
+int ofxIMEBase::addSpan(int beginLine, int beginPos, int endLine, int endPos, const ofxIMESpanStyle &style) {
+    return spans.add(getOffset(beginLine, beginPos), getOffset(endLine, endPos), style);
+}
+
+void ofxIMEBase::notifyEdit(ofxIMEEdit &e) {
+    // The unit index, once built, is patched for the lines the edit touched
+    if (offsetIndex.isBuilt()) {
+        if (e.type == ofxIMEEdit::Reset) {
+            offsetIndex.clear();
+        }
+        else if (e.type == ofxIMEEdit::Insert) {
+            offsetIndex.setLine(e.line, ofxIMEOffsetIndex::measure(line[e.line]));
+            for (int l = e.line + 1; l <= e.endLine; ++l) {
+                offsetIndex.insertLine(l, ofxIMEOffsetIndex::measure(line[l]));
+            }
+        }
+        else if (e.type == ofxIMEEdit::Replace) {
+            for (size_t k = 0; k < e.numHunks; ++k) {
+                int l = e.hunks[k].line;
+                offsetIndex.setLine(l, ofxIMEOffsetIndex::measure(line[l]));
+            }
+        }
+        else {
+            offsetIndex.eraseLines(e.line + 1, e.endLine - e.line);
+            offsetIndex.setLine(e.line, ofxIMEOffsetIndex::measure(line[e.line]));
+        }
+    }
+
+    // Spans follow the text; the edit's start is before anything it changed,
+    // so its offset is the same before and after. The index above is up to
+    // date (or built now), so this is O(log lines)
+    if (spans.size() > 0) {
+        if (e.type == ofxIMEEdit::Reset) {
+            spans.clear();
+        }
+        else if (e.type == ofxIMEEdit::Replace) {
+            // All spans in one pass. A hunk's line started, before the edit,
+            // where it starts now less what the hunks above it added
+            replaceStarts.resize(e.numHunks);
+            int delta = 0;
+            for (size_t k = 0; k < e.numHunks; ++k) {
+                const ofxIMEEdit::Hunk &h = e.hunks[k];
+                replaceStarts[k] = {getOffset(h.line, 0) - delta, delta};
+                delta += (int)h.text.length() - h.erased;
+            }
+            spans.remap([&](int offset) {
+                auto it = std::upper_bound(replaceStarts.begin(), replaceStarts.end(), offset,
+                    [](int o, const pair<int, int> &s) { return o < s.first; });
+                if (it == replaceStarts.begin()) return offset;
+                --it;
+                int p = offset - it->first;
+                return it->first + it->second + mapThroughHunk(p, e.hunks[it - replaceStarts.begin()]);
+            });
+        }
+        else {
+            int offset = getOffset(e.line, e.pos);
+            if (e.type == ofxIMEEdit::Insert) spans.insert(offset, e.length);
+            else spans.erase(offset, offset + e.length);
+        }
+    }
+    // Pastes in progress keep their place in the text. Their own chunks go in
+    // at the end of their range; others' edits there stay out of it
+    if (!pastes.empty()) {
+        if (e.type == ofxIMEEdit::Reset) {
+            cancelPaste();
+        }
+        else {
+            for (auto &p : pastes) {
+                if (p.get() == pasteInserting) continue;
+                mapThroughEdit(p->beginLine, p->beginPos, e, pasteInserting == nullptr);
+                mapThroughEdit(p->endLine, p->endPos, e, pasteInserting == nullptr);
+            }
+        }
+    }
+
+    ofNotifyEvent(editEvent, e, this);
+}
+
+void ofxIMEBase::setCompletion(ofxIMECompletion *c, int maxResults) {
+    completion = c;
+    maxCompletions = maxResults;
+    completions.clear();
+    completionQuery.clear();
+}
+
+void ofxIMEBase::updateCompletions() {
+    if (!completion) return;
+
+    // The word before the cursor plus whatever is being composed
+    std::u32string_view cur = line[cursorLine];
+    int begin = cursorPos;
+    while (begin > 0 && cursorPos - begin < 32 && ofxIMECompletion::isWordChar(cur[begin - 1])) {
+        begin--;
+    }
+    std::u32string_view word = cur.substr(begin, cursorPos - begin);
+    if (completionRevision == completion->getRevision() &&
+        completionQuery.length() == word.length() + markedText.length() &&
+        std::u32string_view(completionQuery).substr(0, word.length()) == word &&
+        std::u32string_view(completionQuery).substr(word.length()) == markedText) {
+        return;
+    }
+    completionQuery.assign(word.data(), word.length());
+    completionQuery += markedText;
+    completionRevision = completion->getRevision();
+
+    // Japanese has no spaces, so the run before the cursor may be a whole
+    // sentence; use its longest tail that something was learned for
+    completions.clear();
+    std::u32string_view query = completionQuery;
+    for (size_t i = 0; i + 2 <= query.length(); ++i) {
+        completion->lookup(query.substr(i), maxCompletions, completions);
+        if (!completions.empty()) {
+            completionPrefixLength = (int)(query.length() - i);
+            break;
+        }
+    }
+}
+
+bool ofxIMEBase::acceptCompletion() {
+    if (completions.empty() || markedText.length() > 0) return false;
+    std::u32string_view phrase = completions[0];
+
+    // Count the accepted phrase as a whole, not the tail that gets inserted
+    insertLines(phrase.substr(MIN(completionPrefixLength, (int)phrase.length())));
+    completion->learn(phrase);
+    return true;
+}
+
+void ofxIMEBase::commitText(std::u32string_view str) {
+    // Only text the user committed is learned, not pastes, appends,
+    // updateString or journal replay, which all go through insertLines
+    int l = cursorLine, p = cursorPos;
+    insertLines(str);
+    if (completion && !str.empty()) {
+        completion->learnFromInsert(str, line[l], p);
+    }
+}
+
+namespace {
+    // Snapshot layout: this header, then 32-bit arrays that are copied as-is
+    //   uint32 lineLength[numLines], char32_t text[textLength]
+    //   char32_t marked[markedLength]
+    //   uint32 candidateLength[numCandidates], char32_t candidateText[candidateTextLength]
+    struct SnapshotHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t headerSize;    // later versions may append fields; readers skip them
+        uint32_t numLines;
+        uint32_t textLength;
+        int32_t cursorLine, cursorPos;
+        int32_t selectBeginLine, selectBeginPos, selectEndLine, selectEndPos;
+        int32_t state;
+        uint32_t markedLength;
+        int32_t markedSelectedLocation, markedSelectedLength;
+        uint32_t numCandidates;
+        uint32_t candidateTextLength;
+        int32_t candidateSelectedIndex;
+    };
+    const char snapshotMagic[4] = {'I', 'M', 'E', 'S'};
+    const uint32_t snapshotVersion = 1;
+
+    // Bounds-checked reads; the buffer may be unaligned, so copy rather than cast
+    struct SnapshotReader {
+        const char *p, *end;
+        bool ok = true;
+
+        const char *take(uint64_t bytes) {
+            if (!ok || (uint64_t)(end - p) < bytes) { ok = false; return nullptr; }
+            const char *r = p;
+            p += bytes;
+            return r;
+        }
+        uint32_t u32() {
+            uint32_t v = 0;
+            if (const char *r = take(4)) memcpy(&v, r, 4);
+            return v;
+        }
+        template<typename Str>
+        void chars(Str &dst, uint32_t n) {
+            const char *r = take((uint64_t)n * sizeof(char32_t));
+            if (!r) return;
+            dst.resize(n);
+            if (n > 0) memcpy(&dst[0], r, (size_t)n * sizeof(char32_t));
+        }
+    };
+}
+
+void ofxIMEBase::saveSnapshot(ofBuffer &dst) const {
+    SnapshotHeader h = {};
+    memcpy(h.magic, snapshotMagic, 4);
+    h.version = snapshotVersion;
+    h.headerSize = sizeof(SnapshotHeader);
+    h.numLines = line.size();
+    for (auto &l : line) h.textLength += l.length();
+    h.cursorLine = cursorLine;
+    h.cursorPos = cursorPos;
+    h.selectBeginLine = get<0>(selectBegin);
+    h.selectBeginPos = get<1>(selectBegin);
+    h.selectEndLine = get<0>(selectEnd);
+    h.selectEndPos = get<1>(selectEnd);
+    h.state = state;
+    h.markedLength = markedText.length();
+    h.markedSelectedLocation = markedSelectedLocation;
+    h.markedSelectedLength = markedSelectedLength;
+    h.numCandidates = candidates.size();
+    for (auto &c : candidates) h.candidateTextLength += c.length();
+    h.candidateSelectedIndex = candidateSelectedIndex;
+
+    size_t total = sizeof(h)
+        + (h.numLines + h.numCandidates) * sizeof(uint32_t)
+        + (h.textLength + h.markedLength + h.candidateTextLength) * sizeof(char32_t);
+    dst.allocate(total);
+
+    char *p = dst.getData();
+    auto put = [&p](const void *src, size_t bytes) {
+        if (bytes > 0) memcpy(p, src, bytes);
+        p += bytes;
+    };
+    put(&h, sizeof(h));
+    for (auto &l : line) {
+        uint32_t n = l.length();
+        put(&n, 4);
+    }
+    for (auto &l : line) put(l.data(), l.length() * sizeof(char32_t));
+    put(markedText.data(), markedText.length() * sizeof(char32_t));
+    for (auto &c : candidates) {
+        uint32_t n = c.length();
+        put(&n, 4);
+    }
+    for (auto &c : candidates) put(c.data(), c.length() * sizeof(char32_t));
+}
+
+bool ofxIMEBase::loadSnapshot(const char *data, size_t size) {
+    SnapshotReader in{data, data + size};
+
+    SnapshotHeader h;
+    const char *head = in.take(sizeof(h));
+    if (!head || memcmp(head, snapshotMagic, 4) != 0) {
+        ofLogError("ofxIME") << "loadSnapshot: not a snapshot";
+        return false;
+    }
+    memcpy(&h, head, sizeof(h));
+    if (h.version == 0 || h.version > snapshotVersion || h.headerSize < sizeof(h)) {
+        ofLogError("ofxIME") << "loadSnapshot: unsupported version " << h.version;
+        return false;
+    }
+    in.take(h.headerSize - sizeof(h));
+    if (!in.ok || h.numLines == 0) {
+        ofLogError("ofxIME") << "loadSnapshot: truncated";
+        return false;
+    }
+
+    // Validate every length before touching the current state
+    SnapshotReader check = in;
+    uint64_t textLength = 0, candidateTextLength = 0;
+    for (uint32_t i = 0; i < h.numLines; ++i) textLength += check.u32();
+    check.take((textLength + h.markedLength) * sizeof(char32_t));
+    for (uint32_t i = 0; i < h.numCandidates; ++i) candidateTextLength += check.u32();
+    check.take(candidateTextLength * sizeof(char32_t));
+    if (!check.ok) {
+        ofLogError("ofxIME") << "loadSnapshot: truncated";
+        return false;
+    }
+
+    // Existing line strings are reused, so switching between documents of
+    // similar size copies the characters without allocating
+    const char *lengths = in.take((uint64_t)h.numLines * 4);
+    line.resize(h.numLines);
+    for (uint32_t i = 0; i < h.numLines; ++i) {
+        uint32_t n;
+        memcpy(&n, lengths + i * 4, 4);
+        in.chars(line[i], n);
+    }
+    in.chars(markedText, h.markedLength);
+    lengths = in.take((uint64_t)h.numCandidates * 4);
+    candidates.resize(h.numCandidates);
+    for (uint32_t i = 0; i < h.numCandidates; ++i) {
+        uint32_t n;
+        memcpy(&n, lengths + i * 4, 4);
+        in.chars(candidates[i], n);
+    }
+
+    cursorLine = ofClamp(h.cursorLine, 0, (int)line.size() - 1);
+    cursorPos = ofClamp(h.cursorPos, 0, (int)line[cursorLine].length());
+    auto clampPos = [this](int l, int p) {
+        l = ofClamp(l, 0, (int)line.size() - 1);
+        return TextSelectPos(l, ofClamp(p, 0, (int)line[l].length()));
+    };
+    selectBegin = clampPos(h.selectBeginLine, h.selectBeginPos);
+    selectEnd = clampPos(h.selectEndLine, h.selectEndPos);
+    state = h.state == Kana || h.state == Composing ? (State)h.state : Eisu;
+    // Indices into the marked text and candidates are clamped like the cursor;
+    // draw() takes substrings and elements with them
+    markedSelectedLocation = ofClamp(h.markedSelectedLocation, 0, (int)markedText.length());
+    markedSelectedLength = ofClamp(h.markedSelectedLength, 0, (int)markedText.length() - markedSelectedLocation);
+    candidateSelectedIndex = ofClamp(h.candidateSelectedIndex, 0, MAX((int)candidates.size() - 1, 0));
+    cursorBlinkOffsetTime = ofGetElapsedTimef();
+#if OFXIME_BUILTIN_COMPOSER
+    // The composer's pending romaji and the conversion's reading and segments
+    // are not in the snapshot, so a restored composition would not match what
+    // Space and Enter act on. It is dropped; the document and mode are kept
+    composer.reset();
+    conversion.cancel();
+    markedText.clear();
+    markedSelectedLocation = 0;
+    markedSelectedLength = 0;
+    candidates.clear();
+    candidateSelectedIndex = 0;
+    if (state == Composing) state = Kana;
+#endif
+
+    ofxIMEEdit e;
+    e.type = ofxIMEEdit::Reset;
+    notifyEdit(e);
+    return true;
+}
+
+void ofxIMEBase::setMemoryResource(std::pmr::memory_resource *resource) {
+    if (resource == documentResource.getUpstream()) return;
+
+    // Park the text on the default heap, release every block through the
+    // old upstream, then rebuild on the new one
+    vector<u32string> tmp(line.begin(), line.end());
+    decltype(line)(&documentResource).swap(line);
+
+    documentResource.setUpstream(resource);
+    for (auto &l : tmp) {
+        line.emplace_back(l);
+    }
+}
+
+ofxIMEBase::AllocationStats ofxIMEBase::getAllocationStats() const {
+    AllocationStats stats;
+    stats.documentAllocations = documentResource.getAllocations();
+    stats.documentBytesInUse = documentResource.getBytesInUse();
+    stats.frameArenaBytes = frameArena.getLastFrameBytes();
+    stats.frameArenaCapacity = frameArena.getCapacity();
+    stats.frameHeapAllocations = frameArena.getLastFrameUpstreamAllocations() + frameArena.getLastFrameScratchAllocations();
+    return stats;
+}
+
+ofxIMEStats ofxIMEBase::getStats() const {
+#if OFXIME_ENABLE_STATS
+    ofxIMEStats s = stats;
+    s.bytesTranscodedToUTF8 = ofxIMEStats::transcodedToUTF8.load(std::memory_order_relaxed);
+    s.bytesTranscodedToUTF32 = ofxIMEStats::transcodedToUTF32.load(std::memory_order_relaxed);
+    // Frames count their own heap allocations; the document's come from its
+    // resource, which has its own counter (since the last resetStats)
+    s.heapAllocations += documentResource.getAllocations() - documentAllocationsAtReset;
+    s.inputLatencyP50 = s.inputLatency.percentile(0.5);
+    s.inputLatencyP99 = s.inputLatency.percentile(0.99);
+    return s;
+#else
+    return ofxIMEStats();
+#endif
+}
+
+void ofxIMEBase::resetStats() {
+#if OFXIME_ENABLE_STATS
+    stats = ofxIMEStats();
+    pendingInputMicros = 0;
+    documentAllocationsAtReset = documentResource.getAllocations();
+#endif
+}
+
+void ofxIMEBase::drawStats(float x, float y) const {
+#if OFXIME_ENABLE_STATS
+    ofDrawBitmapString(getStats().toString(), x, y);
+#else
+    (void)x;
+    (void)y;
+#endif
+}
+
+#if OFXIME_ENABLE_STATS
+void ofxIMEBase::recordInput() {
+    if (pendingInputMicros == 0) {
+        pendingInputMicros = ofxIMEStats::nowMicros();
+    }
+}
+
+void ofxIMEBase::recordFrame(int linesLaidOut) {
+    stats.linesLaidOut += linesLaidOut;
+    stats.heapAllocations += frameArena.getLastFrameUpstreamAllocations() + frameArena.getLastFrameScratchAllocations();
+
+    // First frame drawn after an OS callback closes its latency sample
+    if (pendingInputMicros != 0) {
+        stats.inputLatency.add(ofxIMEStats::nowMicros() - pendingInputMicros);
+        pendingInputMicros = 0;
+    }
+}
+#endif
+
 void ofxIMEBase::keyPressed(ofKeyEventArgs &key) {
+    OFXIME_STATS_SCOPE(stats.keyPressed);
+    OFXIME_TRACE_SCOPE("ofxIMEBase keyPressed");
+
     // Modifier key handling
 #ifdef TARGET_OS_MAC
     char ctrl = OF_KEY_COMMAND;
@@ -60,25 +597,40 @@ void ofxIMEBase::keyPressed(ofKeyEventArgs &key) {
             // paste
             {
                 string clip = ofGetClipboardString();
-                u32string u32clip = UTF8toUTF32(clip);
-                for (auto c : u32clip) {
-                    if (c == U'\n') newLine();
-                    else {
-                        u32string s(1, c);
-                        addStr(line[cursorLine], s, cursorPos);
-                    }
+                if (clip.size() >= pasteThreshold) {
+                    insertAsync(std::move(clip));
+                }
+                else {
+                    // Windows clipboard text has CRLF; one line break each
+                    u32string text = UTF8toUTF32(clip);
+                    bool afterCR = false;
+                    foldLineBreaks(text, afterCR);
+                    insertLines(text);
                 }
             }
             break;
         case 'a':
             selectAll();
             break;
+#if OFXIME_BUILTIN_COMPOSER
+        case ' ':
+            setJapaneseMode(!isJapaneseMode());
+            break;
+#endif
         default:
             break;
         }
         return;
     }
 
+#if OFXIME_BUILTIN_COMPOSER
+    // No OS IME: characters are composed here
+    if (composeKey(key)) {
+        cursorBlinkOffsetTime = ofGetElapsedTimef();
+        return;
+    }
+#endif
+
     // If IME has marked text, let OS handle it
     if (markedText.length() > 0) {
         // During composing, let OS handle most keys
@@ -105,6 +657,10 @@ void ofxIMEBase::keyPressed(ofKeyEventArgs &key) {
         newLine();
         break;
 
+    case OF_KEY_TAB:
+        acceptCompletion();
+        break;
+
     case OF_KEY_UP:
         lineChange(-1);
         break;
@@ -146,10 +702,590 @@ string ofxIMEBase::getString() {
     return all;
 }
 
+ofxIMEBase::PasteJob::~PasteJob() {
+    cancelled = true;
+    if (worker.joinable()) worker.join();
+}
+
+void ofxIMEBase::insertAsync(string str) {
+    if (str.empty()) return;
+
+    auto job = std::make_unique<PasteJob>();
+    job->utf8 = std::move(str);
+    job->beginLine = job->endLine = cursorLine;
+    job->beginPos = job->endPos = cursorPos;
+    PasteJob &j = *job;
+    j.worker = std::thread([&j] { decodePaste(j); });
+
+    if (pastes.empty()) {
+        ofAddListener(ofEvents().update, this, &ofxIMEBase::updatePaste);
+    }
+    pastes.push_back(std::move(job));
+}
+
+void ofxIMEBase::decodePaste(PasteJob &job) {
+    // In slices, so a cancel does not wait for the whole text. Slices end on
+    // a character boundary; line breaks become a single '\n' each and their
+    // positions are kept, so the main thread splices lines without scanning
+    const size_t sliceBytes = 1 << 20;
+    std::string_view src = job.utf8;
+    u32string slice;
+    job.text.reserve(src.size());
+    bool afterCR = false;
+    for (size_t begin = 0; begin < src.size() && !job.cancelled;) {
+        size_t end = MIN(begin + sliceBytes, src.size());
+        while (end < src.size() && (src[end] & 0xC0) == 0x80) end++;
+        UTF8toUTF32(src.substr(begin, end - begin), slice);
+        foldLineBreaks(slice, afterCR);
+        for (size_t i = 0; i < slice.size(); ++i) {
+            if (slice[i] == U'\n') job.breaks.push_back(job.text.size() + i);
+        }
+        job.text += slice;
+        begin = end;
+    }
+    job.utf8 = string();
+    job.ready.store(true, std::memory_order_release);
+}
+
+void ofxIMEBase::updatePaste(ofEventArgs &) {
+    auto start = std::chrono::steady_clock::now();
+    auto budget = std::chrono::microseconds((int64_t)(pasteBudgetMillis * 1000));
+
+    // Chunks of whole lines, about chunkChars each, until the frame's budget
+    // is used up. A line longer than a chunk is split
+    const size_t chunkChars = 1 << 14;
+    while (!pastes.empty()) {
+        PasteJob &job = *pastes.front();
+        if (!job.ready.load(std::memory_order_acquire)) return;
+
+        if (job.inserted < job.text.size()) {
+            size_t end = MIN(job.inserted + chunkChars, job.text.size());
+            if (end < job.text.size()) {
+                auto last = std::lower_bound(job.breaks.begin() + job.insertedBreaks, job.breaks.end(), end);
+                if (last != job.breaks.begin() + job.insertedBreaks) end = *(last - 1) + 1;
+            }
+            insertPasteChunk(job, end);
+        }
+        if (job.inserted == job.text.size()) {
+            pastes.pop_front();
+            if (pastes.empty()) {
+                ofRemoveListener(ofEvents().update, this, &ofxIMEBase::updatePaste);
+            }
+        }
+        if (std::chrono::steady_clock::now() - start >= budget) return;
+    }
+}
+
+void ofxIMEBase::insertPasteChunk(PasteJob &job, size_t end) {
+    std::u32string_view chunk = std::u32string_view(job.text).substr(job.inserted, end - job.inserted);
+    size_t numBreaks = std::lower_bound(job.breaks.begin() + job.insertedBreaks, job.breaks.end(), end) -
+        (job.breaks.begin() + job.insertedBreaks);
+
+    // A cursor waiting at the end of the pasted text follows it; one elsewhere
+    // only moves if the text went in before it
+    bool follow = cursorLine == job.endLine && cursorPos == job.endPos;
+    int cl = cursorLine, cp = cursorPos;
+    int sbl, sbp, sel, sep;
+    tie(sbl, sbp) = selectBegin;
+    tie(sel, sep) = selectEnd;
+
+    pasteInserting = &job;
+    cursorLine = job.endLine;
+    cursorPos = job.endPos;
+    insertLines(chunk, job.breaks.data() + job.insertedBreaks, numBreaks, job.inserted);
+    pasteInserting = nullptr;
+    job.inserted = end;
+    job.insertedBreaks += numBreaks;
+
+    ofxIMEEdit e;
+    e.type = ofxIMEEdit::Insert;
+    e.line = job.endLine;
+    e.pos = job.endPos;
+    e.endLine = cursorLine;
+    e.endPos = cursorPos;
+    job.endLine = cursorLine;
+    job.endPos = cursorPos;
+
+    if (!follow) {
+        mapThroughEdit(cl, cp, e, true);
+        cursorLine = cl;
+        cursorPos = cp;
+    }
+    mapThroughEdit(sbl, sbp, e, true);
+    mapThroughEdit(sel, sep, e, true);
+    selectBegin = TextSelectPos(sbl, sbp);
+    selectEnd = TextSelectPos(sel, sep);
+}
+
+float ofxIMEBase::getPasteProgress() const {
+    if (pastes.empty()) return 1;
+    const PasteJob &job = *pastes.front();
+    if (!job.ready.load(std::memory_order_acquire) || job.text.empty()) return 0;
+    return (float)job.inserted / job.text.size();
+}
+
+bool ofxIMEBase::getPasteRange(int &beginLine, int &beginPos, int &endLine, int &endPos) const {
+    if (pastes.empty()) return false;
+    const PasteJob &job = *pastes.front();
+    beginLine = job.beginLine;
+    beginPos = job.beginPos;
+    endLine = job.endLine;
+    endPos = job.endPos;
+    return true;
+}
+
+void ofxIMEBase::cancelPaste(bool revert) {
+    if (pastes.empty()) return;
+    ofRemoveListener(ofEvents().update, this, &ofxIMEBase::updatePaste);
+
+    // Taken out one by one, so erasing one still moves the ranges of the rest
+    while (!pastes.empty()) {
+        std::unique_ptr<PasteJob> job = std::move(pastes.front());
+        pastes.pop_front();
+        job->cancelled = true;
+        if (revert) revertPaste(*job);
+    }
+}
+
+void ofxIMEBase::revertPaste(PasteJob &job) {
+    if (job.beginLine == job.endLine && job.beginPos == job.endPos) return;
+
+    // Only the paste's own text goes. The range loses the head and tail that
+    // still match what was pasted; edits made inside it since stay, with
+    // whatever pasted text lies between them
+    u32string range;
+    getRangeUTF32(job.beginLine, job.beginPos, job.endLine, job.endPos, range);
+    std::u32string_view pasted = std::u32string_view(job.text).substr(0, job.inserted);
+    size_t head = 0;
+    while (head < range.size() && head < pasted.size() && range[head] == pasted[head]) head++;
+    size_t tail = 0;
+    while (tail < range.size() - head && tail < pasted.size() - head &&
+           range[range.size() - 1 - tail] == pasted[pasted.size() - 1 - tail]) {
+        tail++;
+    }
+
+    // The tail first, so the head's positions still hold
+    size_t begin = getOffset(job.beginLine, job.beginPos, ofxIMEOffsetIndex::UTF32);
+    int l, p;
+    if (tail > 0) {
+        getPosition(begin + range.size() - tail, ofxIMEOffsetIndex::UTF32, l, p);
+        eraseRange(l, p, job.endLine, job.endPos);
+    }
+    if (head > 0) {
+        getPosition(begin + head, ofxIMEOffsetIndex::UTF32, l, p);
+        eraseRange(job.beginLine, job.beginPos, l, p);
+    }
+}
+
+void ofxIMEBase::append(const string &str) {
+    UTF8toUTF32(str, appendText);
+    append(std::u32string_view(appendText));
+}
+
+void ofxIMEBase::append(std::u32string_view str) {
+    if (str.empty()) return;
+    OFXIME_TRACE_SCOPE("ofxIMEBase append");
+
+    // Line breaks as in pastes: CRLF and CR become '\n' (in place if str is
+    // appendText already)
+    if (str.find(U'\r') != str.npos) {
+        if (str.data() != appendText.data()) appendText.assign(str.data(), str.size());
+        bool afterCR = false;
+        foldLineBreaks(appendText, afterCR);
+        str = appendText;
+    }
+    size_t breaks = std::count(str.begin(), str.end(), U'\n');
+
+    // Lines over the limit go before anything is added, their buffers kept for
+    // the new lines. Text with more lines than the limit only keeps its last ones
+    if (maxLines > 0) {
+        if (breaks >= (size_t)maxLines) {
+            size_t skip = breaks - maxLines + 1;
+            size_t p = 0;
+            for (size_t k = 0; k < skip; ++k) p = str.find(U'\n', p) + 1;
+            str = str.substr(p);
+            breaks = maxLines - 1;
+            dropFirstLines((int)line.size(), breaks);
+            droppedLines += skip;
+        }
+        else if ((int)(line.size() + breaks) > maxLines) {
+            dropFirstLines((int)(line.size() + breaks) - maxLines, breaks);
+        }
+    }
+
+    ofxIMEEdit e;
+    e.type = ofxIMEEdit::Insert;
+    e.line = (int)line.size() - 1;
+    e.pos = (int)line.back().length();
+    e.length = (int)str.length();
+    e.text = str;
+
+    size_t end = str.find(U'\n');
+    line.back().append(str.substr(0, end));
+    while (end != str.npos) {
+        size_t begin = end + 1;
+        end = str.find(U'\n', begin);
+        if (!spareLines.empty()) {
+            line.push_back(std::move(spareLines.back()));
+            spareLines.pop_back();
+        }
+        else {
+            line.emplace_back();
+        }
+        line.back().assign(str.substr(begin, end == str.npos ? str.npos : end - begin));
+    }
+    spareLines.clear();
+
+    // The cursor and selection stay put, even when they were at the end
+    e.endLine = (int)line.size() - 1;
+    e.endPos = (int)line.back().length();
+    notifyEdit(e);
+}
+
+void ofxIMEBase::setMaxLines(int n) {
+    maxLines = MAX(n, 0);
+    if (maxLines > 0 && (int)line.size() > maxLines) {
+        dropFirstLines((int)line.size() - maxLines, 0);
+    }
+}
+
+void ofxIMEBase::dropFirstLines(int n, size_t spare) {
+    n = MIN(n, (int)line.size());
+    if (n <= 0) return;
+
+    // Dropping every line empties the last one rather than removing it
+    bool all = n == (int)line.size();
+    if (all && n == 1 && line[0].empty()) return;
+    int whole = all ? n - 1 : n;
+
+    ofxIMEEdit e;
+    e.type = ofxIMEEdit::Erase;
+    e.line = 0;
+    e.pos = 0;
+    e.endLine = all ? n - 1 : n;
+    e.endPos = all ? (int)line.back().length() : 0;
+    e.length = e.endPos;
+    for (int i = 0; i < whole; ++i) {
+        e.length += (int)line[i].length() + 1;
+        if (spareLines.size() < spare) {
+            spareLines.push_back(std::move(line[i]));
+            spareLines.back().clear();
+        }
+    }
+    line.erase(line.begin(), line.begin() + whole);
+    if (all) line[0].clear();
+    droppedLines += whole;
+
+    // Positions in the dropped lines go to the top
+    int sbl, sbp, sel, sep;
+    tie(sbl, sbp) = selectBegin;
+    tie(sel, sep) = selectEnd;
+    mapThroughEdit(cursorLine, cursorPos, e, true);
+    mapThroughEdit(sbl, sbp, e, true);
+    mapThroughEdit(sel, sep, e, true);
+    selectBegin = TextSelectPos(sbl, sbp);
+    selectEnd = TextSelectPos(sel, sep);
+
+    notifyEdit(e);
+}
+
 void ofxIMEBase::setString(const string &str) {
     clear();
-    u32string u32str = UTF8toUTF32(str);
-    insertText(u32str);
+    insertLines(UTF8toUTF32(str));
+}
+
+void ofxIMEBase::updateString(const string &str) {
+    UTF8toUTF32(str, updateText);
+    updateString(updateText);
+}
+
+void ofxIMEBase::updateString(std::u32string_view str) {
+    // Lines of the new text, split the way insertLines() splits them
+    updateLines.clear();
+    size_t begin = 0;
+    for (size_t i = 0; i < str.length(); ++i) {
+        if (str[i] == U'\n' || str[i] == U'\r') {
+            updateLines.push_back(str.substr(begin, i - begin));
+            begin = i + 1;
+        }
+    }
+    updateLines.push_back(str.substr(begin));
+
+    // Lines in common at the start; an unchanged text stops here
+    int oldCount = (int)line.size();
+    int newCount = (int)updateLines.size();
+    int prefix = 0;
+    while (prefix < oldCount && prefix < newCount &&
+           std::u32string_view(line[prefix]) == updateLines[prefix]) {
+        prefix++;
+    }
+    if (prefix == oldCount && prefix == newCount) return;
+
+    // ...and at the end
+    int oldEnd = oldCount, newEnd = newCount;
+    while (oldEnd > prefix && newEnd > prefix &&
+           std::u32string_view(line[oldEnd - 1]) == updateLines[newEnd - 1]) {
+        oldEnd--;
+        newEnd--;
+    }
+
+    diffLines(prefix, oldEnd, newEnd);
+
+    // Hunks come bottom up, so the lines of those still to go keep their indices
+    for (auto &h : updateHunks) {
+        replaceHunk(h);
+    }
+}
+
+bool ofxIMEBase::normalize(int flags) {
+    int n = (int)line.size();
+    normalizeOut.resize(n);
+    normalizeChanged.assign(n, 0);
+
+    // Lines are independent, so a large document is split by line across the
+    // pool. Workers only fill their own buffers: the document's memory resource
+    // need not be thread-safe, so it is only written below on this thread
+    auto normalizeRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            normalizeChanged[i] = ofxIMENormalizer::apply(line[i], flags, normalizeOut[i]);
+        }
+    };
+    const int parallelLines = 1024;
+    if (n < parallelLines) normalizeRange(0, n);
+    else ofxIMEThreadPool::get().parallelFor(n, 256, normalizeRange);
+
+    if (std::find(normalizeChanged.begin(), normalizeChanged.end(), 1) == normalizeChanged.end()) {
+        return false;
+    }
+
+    // The cursor and selection keep their place in the text: a position maps
+    // to the length of its line's prefix after the same transform
+    auto map = [&](int l, int p) {
+        if (l < 0 || l >= n || !normalizeChanged[l]) return p;
+        std::u32string_view prefix = std::u32string_view(line[l]).substr(0, p);
+        return ofxIMENormalizer::apply(prefix, flags, normalizePrefix) ? (int)normalizePrefix.length() : p;
+    };
+    int sbl, sbp, sel, sep;
+    tie(sbl, sbp) = selectBegin;
+    tie(sel, sep) = selectEnd;
+    cursorPos = map(cursorLine, cursorPos);
+    selectBegin = TextSelectPos(sbl, map(sbl, sbp));
+    selectEnd = TextSelectPos(sel, map(sel, sep));
+
+    // Each changed line is rewritten in its changed middle, and the whole
+    // document is reported as one Replace of those hunks: the offset index,
+    // spans, pastes in progress and the journal take it as one edit. The
+    // per-line buffers are kept for the next call
+    normalizeHunks.clear();
+    for (int i = 0; i < n; ++i) {
+        if (!normalizeChanged[i]) continue;
+        std::u32string_view o = line[i], r = normalizeOut[i];
+        size_t head = 0;
+        while (head < o.size() && head < r.size() && o[head] == r[head]) head++;
+        size_t tail = 0;
+        while (tail < o.size() - head && tail < r.size() - head &&
+               o[o.size() - 1 - tail] == r[r.size() - 1 - tail]) {
+            tail++;
+        }
+        ofxIMEEdit::Hunk h;
+        h.line = i;
+        h.pos = (int)head;
+        h.erased = (int)(o.size() - head - tail);
+        h.text = r.substr(head, r.size() - head - tail);
+        line[i].replace(head, h.erased, h.text);
+        normalizeHunks.push_back(h);
+    }
+
+    ofxIMEEdit e;
+    e.type = ofxIMEEdit::Replace;
+    e.hunks = normalizeHunks.data();
+    e.numHunks = normalizeHunks.size();
+    e.line = e.hunks[0].line;
+    e.pos = e.hunks[0].pos;
+    e.endLine = normalizeHunks.back().line;
+    e.endPos = normalizeHunks.back().pos + (int)normalizeHunks.back().text.length();
+    notifyEdit(e);
+    return true;
+}
+
+void ofxIMEBase::diffLines(int prefix, int oldEnd, int newEnd) {
+    updateHunks.clear();
+    int n = oldEnd - prefix;
+    int m = newEnd - prefix;
+    if (n == 0 || m == 0) {
+        updateHunks.push_back({prefix, oldEnd, prefix, newEnd});
+        return;
+    }
+
+    // Compare hashes first so most line comparisons are one integer
+    std::hash<std::u32string_view> hash;
+    oldLineHashes.resize(n);
+    newLineHashes.resize(m);
+    for (int i = 0; i < n; ++i) oldLineHashes[i] = hash(line[prefix + i]);
+    for (int i = 0; i < m; ++i) newLineHashes[i] = hash(updateLines[prefix + i]);
+    auto equal = [&](int x, int y) {
+        return oldLineHashes[x] == newLineHashes[y] &&
+               std::u32string_view(line[prefix + x]) == updateLines[prefix + y];
+    };
+
+    // Myers' greedy diff. The furthest x on diagonals -d..d is kept for every d
+    // (at myersTrace[d * d]) to walk the path back; past maxDistance the middle
+    // is replaced as one hunk rather than letting the trace grow quadratically
+    const int maxDistance = 1024;
+    myersTrace.clear();
+    int distance = -1;
+    for (int d = 0; d <= MIN(n + m, maxDistance) && distance < 0; ++d) {
+        myersTrace.resize((size_t)(d + 1) * (d + 1));
+        int *v = myersTrace.data() + (size_t)d * d + d;
+        const int *prev = d > 0 ? myersTrace.data() + (size_t)(d - 1) * (d - 1) + (d - 1) : nullptr;
+        for (int k = -d; k <= d; k += 2) {
+            int x;
+            if (d == 0) x = 0;
+            else if (k == -d || (k != d && prev[k - 1] < prev[k + 1])) x = prev[k + 1];
+            else x = prev[k - 1] + 1;
+            int y = x - k;
+            while (x < n && y < m && equal(x, y)) {
+                x++;
+                y++;
+            }
+            v[k] = x;
+            if (x >= n && y >= m) {
+                distance = d;
+                break;
+            }
+        }
+    }
+    if (distance < 0) {
+        updateHunks.push_back({prefix, oldEnd, prefix, newEnd});
+        return;
+    }
+
+    // Walk back from the end, joining neighbouring insertions and deletions into hunks
+    auto addEdit = [&](int oldLine, int newLine, bool insertion) {
+        int o0 = prefix + oldLine, n0 = prefix + newLine;
+        int o1 = o0 + (insertion ? 0 : 1), n1 = n0 + (insertion ? 1 : 0);
+        if (!updateHunks.empty() && updateHunks.back().oldBegin == o1 && updateHunks.back().newBegin == n1) {
+            updateHunks.back().oldBegin = o0;
+            updateHunks.back().newBegin = n0;
+        }
+        else {
+            updateHunks.push_back({o0, o1, n0, n1});
+        }
+    };
+    int x = n, y = m;
+    for (int d = distance; d > 0; --d) {
+        const int *prev = myersTrace.data() + (size_t)(d - 1) * (d - 1) + (d - 1);
+        int k = x - y;
+        bool insertion = k == -d || (k != d && prev[k - 1] < prev[k + 1]);
+        int pk = insertion ? k + 1 : k - 1;
+        int px = prev[pk];
+        int py = px - pk;
+        addEdit(px, py, insertion);
+        x = px;
+        y = py;
+    }
+}
+
+void ofxIMEBase::replaceHunk(const LineHunk &h) {
+    // The hunk as text: its lines with their line breaks. A hunk reaching the end
+    // of the document has no break after its last line, so it takes the one before
+    bool atEnd = h.oldEnd == (int)line.size();
+    int startLine = h.oldBegin, startPos = 0;
+    hunkOld.clear();
+    hunkNew.clear();
+    if (atEnd && h.oldBegin > 0) {
+        startLine = h.oldBegin - 1;
+        startPos = (int)line[startLine].length();
+        for (int i = h.oldBegin; i < h.oldEnd; ++i) {
+            hunkOld += U'\n';
+            hunkOld += std::u32string_view(line[i]);
+        }
+        for (int i = h.newBegin; i < h.newEnd; ++i) {
+            hunkNew += U'\n';
+            hunkNew += updateLines[i];
+        }
+    }
+    else {
+        for (int i = h.oldBegin; i < h.oldEnd; ++i) {
+            hunkOld += std::u32string_view(line[i]);
+            if (!atEnd || i + 1 < h.oldEnd) hunkOld += U'\n';
+        }
+        for (int i = h.newBegin; i < h.newEnd; ++i) {
+            hunkNew += updateLines[i];
+            if (!atEnd || i + 1 < h.newEnd) hunkNew += U'\n';
+        }
+    }
+
+    // Only the part between the characters in common at both ends changes,
+    // so editing one line rewrites just the edited characters
+    std::u32string_view o = hunkOld, n = hunkNew;
+    size_t head = 0;
+    while (head < o.size() && head < n.size() && o[head] == n[head]) head++;
+    size_t tail = 0;
+    while (tail < o.size() - head && tail < n.size() - head &&
+           o[o.size() - 1 - tail] == n[n.size() - 1 - tail]) {
+        tail++;
+    }
+    std::u32string_view erased = o.substr(head, o.size() - head - tail);
+    std::u32string_view inserted = n.substr(head, n.size() - head - tail);
+
+    auto advance = [](std::u32string_view s, int &l, int &p) {
+        for (char32_t c : s) {
+            if (c == U'\n') {
+                l++;
+                p = 0;
+            }
+            else {
+                p++;
+            }
+        }
+    };
+    int bl = startLine, bp = startPos;
+    advance(o.substr(0, head), bl, bp);
+    int el = bl, ep = bp;
+    advance(erased, el, ep);
+    int breaks = 0, lastLength = 0;
+    advance(inserted, breaks, lastLength);
+
+    // Positions before the change stay, positions after it move with the text,
+    // and positions inside it go to the end of the new text
+    auto map = [&](int &l, int &p) {
+        if (l < bl || (l == bl && p < bp)) return;
+        if (l < el || (l == el && p < ep)) {
+            l = el;
+            p = ep;
+        }
+        if (l == el) {
+            p = (breaks == 0 ? bp : 0) + lastLength + (p - ep);
+            l = bl + breaks;
+        }
+        else {
+            l += breaks - (el - bl);
+        }
+    };
+    int cl = cursorLine, cp = cursorPos;
+    int sbl, sbp, sel, sep;
+    tie(sbl, sbp) = selectBegin;
+    tie(sel, sep) = selectEnd;
+    map(cl, cp);
+    map(sbl, sbp);
+    map(sel, sep);
+
+    if (!erased.empty()) {
+        selectBegin = TextSelectPos(bl, bp);
+        selectEnd = TextSelectPos(el, ep);
+        deleteSelected();
+    }
+    if (!inserted.empty()) {
+        cursorLine = bl;
+        cursorPos = bp;
+        insertLines(inserted);
+    }
+
+    cursorLine = cl;
+    cursorPos = cp;
+    selectBegin = TextSelectPos(sbl, sbp);
+    selectEnd = TextSelectPos(sel, sep);
 }
 
 u32string ofxIMEBase::getU32String() {
@@ -174,7 +1310,7 @@ string ofxIMEBase::getLine(int l) {
 
 string ofxIMEBase::getLineSubstr(int l, int begin, int end) {
     if (0 <= l && l < (int)line.size()) {
-        return UTF32toUTF8(line[l].substr(begin, end));
+        return UTF32toUTF8(std::u32string_view(line[l]).substr(begin, end));
     }
     return "";
 }
@@ -184,11 +1320,93 @@ string ofxIMEBase::getMarkedText() {
 }
 
 string ofxIMEBase::getMarkedTextSubstr(int begin, int end) {
-    return UTF32toUTF8(markedText.substr(begin, end));
+    return UTF32toUTF8(std::u32string_view(markedText).substr(begin, end));
+}
+
+int ofxIMEBase::getLineLength(int l) const {
+    return 0 <= l && l < (int)line.size() ? (int)line[l].length() : 0;
+}
+
+void ofxIMEBase::clampRange(int &bl, int &bp, int &el, int &ep) const {
+    bl = ofClamp(bl, 0, (int)line.size() - 1);
+    bp = ofClamp(bp, 0, (int)line[bl].length());
+    el = ofClamp(el, 0, (int)line.size() - 1);
+    ep = ofClamp(ep, 0, (int)line[el].length());
+    if (bl > el || (bl == el && bp > ep)) {
+        std::swap(bl, el);
+        std::swap(bp, ep);
+    }
+}
+
+size_t ofxIMEBase::getRangeLengthUTF8(int bl, int bp, int el, int ep) const {
+    size_t n = 0;
+    forEachRangePart(bl, bp, el, ep, [&](std::u32string_view s) {
+        for (char32_t c : s) {
+            n += c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+        }
+    });
+    return n;
+}
+
+size_t ofxIMEBase::getRangeLengthUTF16(int bl, int bp, int el, int ep) const {
+    size_t n = 0;
+    forEachRangePart(bl, bp, el, ep, [&](std::u32string_view s) {
+        n += s.size();
+        for (char32_t c : s) {
+            if (c >= 0x10000) n++;
+        }
+    });
+    return n;
+}
+
+size_t ofxIMEBase::getRangeLengthUTF32(int bl, int bp, int el, int ep) const {
+    size_t n = 0;
+    forEachRangePart(bl, bp, el, ep, [&](std::u32string_view s) {
+        n += s.size();
+    });
+    return n;
+}
+
+size_t ofxIMEBase::copyRangeUTF8(int bl, int bp, int el, int ep, char *dst, size_t capacity) const {
+    size_t n = getRangeLengthUTF8(bl, bp, el, ep);
+    if (n <= capacity) copyRangeUTF8(bl, bp, el, ep, dst);
+    return n;
+}
+
+size_t ofxIMEBase::copyRangeUTF16(int bl, int bp, int el, int ep, char16_t *dst, size_t capacity) const {
+    size_t n = getRangeLengthUTF16(bl, bp, el, ep);
+    if (n <= capacity) copyRangeUTF16(bl, bp, el, ep, dst);
+    return n;
+}
+
+size_t ofxIMEBase::copyRangeUTF32(int bl, int bp, int el, int ep, char32_t *dst, size_t capacity) const {
+    size_t n = getRangeLengthUTF32(bl, bp, el, ep);
+    if (n <= capacity) copyRangeUTF32(bl, bp, el, ep, dst);
+    return n;
+}
+
+// Sized first, then written in place: the string only grows when it has to
+void ofxIMEBase::getRangeUTF8(int bl, int bp, int el, int ep, string &dst) const {
+    dst.resize(getRangeLengthUTF8(bl, bp, el, ep));
+    copyRangeUTF8(bl, bp, el, ep, dst.data());
+}
+
+void ofxIMEBase::getRangeUTF16(int bl, int bp, int el, int ep, std::u16string &dst) const {
+    dst.resize(getRangeLengthUTF16(bl, bp, el, ep));
+    copyRangeUTF16(bl, bp, el, ep, dst.data());
+}
+
+void ofxIMEBase::getRangeUTF32(int bl, int bp, int el, int ep, u32string &dst) const {
+    dst.resize(getRangeLengthUTF32(bl, bp, el, ep));
+    copyRangeUTF32(bl, bp, el, ep, dst.data());
 }
 
 // Receive confirmed text from IME
 void ofxIMEBase::insertText(const u32string &str) {
+    OFXIME_STATS_SCOPE(stats.insertText);
+    OFXIME_TRACE_SCOPE("ofxIMEBase insertText");
+    OFXIME_STATS(recordInput());
+
     // Clear marked text
     markedText = U"";
     markedSelectedLocation = 0;
@@ -196,22 +1414,17 @@ void ofxIMEBase::insertText(const u32string &str) {
     candidates.clear();
     candidateSelectedIndex = 0;
 
-    // Process newlines
-    for (auto c : str) {
-        if (c == U'\n' || c == U'\r') {
-            newLine();
-        }
-        else {
-            u32string s(1, c);
-            addStr(line[cursorLine], s, cursorPos);
-        }
-    }
+    commitText(str);
 
     state = (state == Composing) ? Kana : state;
 }
 
 // Receive marked text from IME
 void ofxIMEBase::setMarkedTextFromOS(const u32string &str, int selectedLocation, int selectedLength) {
+    OFXIME_STATS_SCOPE(stats.setMarkedText);
+    OFXIME_TRACE_SCOPE("ofxIMEBase setMarkedTextFromOS");
+    OFXIME_STATS(recordInput());
+
     markedText = str;
     markedSelectedLocation = selectedLocation;
     markedSelectedLength = selectedLength;
@@ -226,9 +1439,11 @@ void ofxIMEBase::setMarkedTextFromOS(const u32string &str, int selectedLocation,
 
 // Confirm marked text
 void ofxIMEBase::unmarkText() {
+    OFXIME_TRACE_SCOPE("ofxIMEBase unmarkText");
+
     if (markedText.length() > 0) {
         // Add marked text as confirmed
-        addStr(line[cursorLine], markedText, cursorPos);
+        commitText(markedText);
         markedText = U"";
         markedSelectedLocation = 0;
         markedSelectedLength = 0;
@@ -238,6 +1453,149 @@ void ofxIMEBase::unmarkText() {
     state = Kana;
 }
 
+void ofxIMEBase::setJapaneseMode(bool japanese) {
+#if OFXIME_BUILTIN_COMPOSER
+    if (japanese) {
+        if (state == Eisu) state = Kana;
+    }
+    else {
+        if (state == Composing) {
+            composer.flush(markedText);
+            unmarkText();
+        }
+        composer.reset();
+        state = Eisu;
+    }
+#endif
+}
+
+#if OFXIME_BUILTIN_COMPOSER
+bool ofxIMEBase::composeKey(ofKeyEventArgs &key) {
+    uint32_t cp = key.codepoint;
+    bool printable = cp >= 0x20 && cp != 0x7F && !(cp >= 0xE000 && cp <= 0xF8FF);
+
+    if (state == Eisu) {
+        // Without an OS IME nothing else delivers typed characters
+        if (!printable) return false;
+        OFXIME_STATS(recordInput());
+        char32_t c = cp;
+        commitText(std::u32string_view(&c, 1));
+        return true;
+    }
+
+    if (conversion.isActive()) {
+        if (convertKey(key)) return true;
+
+        // Typing on commits the conversion and starts a new composition
+        conversion.cancel();
+        unmarkText();
+    }
+
+    if (markedText.empty()) {
+        if (!printable) return false;
+        if (cp == ' ') {
+            commitText(U"　");
+            return true;
+        }
+    }
+
+    if (cp == ' ' && dictionary && dictionary->isOpen()) {
+        composer.flush(markedText);
+        conversion.start(*dictionary, markedText);
+        conversionChanged();
+        return true;
+    }
+
+    if (printable && cp != ' ') {
+        composer.input(cp, markedText);
+        composerChanged();
+        return true;
+    }
+
+    // Keys during composition never reach the confirmed text
+    switch (key.key) {
+    case OF_KEY_BACKSPACE:
+        composer.backspace(markedText);
+        composerChanged();
+        break;
+    case OF_KEY_RETURN:
+    case ' ':
+        composer.flush(markedText);
+        unmarkText();
+        break;
+    case OF_KEY_ESC:
+        markedText.clear();
+        composer.reset();
+        composerChanged();
+        break;
+    case OF_KEY_F6:
+        composer.flush(markedText);
+        ofxIMERomajiComposer::toHiragana(markedText);
+        composerChanged();
+        break;
+    case OF_KEY_F7:
+        composer.flush(markedText);
+        ofxIMERomajiComposer::toKatakana(markedText);
+        composerChanged();
+        break;
+    default:
+        break;
+    }
+    return true;
+}
+
+bool ofxIMEBase::convertKey(ofKeyEventArgs &key) {
+    bool shift = ofGetKeyPressed(OF_KEY_SHIFT);
+    switch (key.key) {
+    case ' ':
+    case OF_KEY_DOWN:
+        conversion.nextCandidate();
+        break;
+    case OF_KEY_UP:
+        conversion.prevCandidate();
+        break;
+    case OF_KEY_RIGHT:
+        if (shift) conversion.resizeSegment(1);
+        else conversion.focusNext();
+        break;
+    case OF_KEY_LEFT:
+        if (shift) conversion.resizeSegment(-1);
+        else conversion.focusPrev();
+        break;
+    case OF_KEY_RETURN:
+        conversion.cancel();
+        unmarkText();
+        return true;
+    case OF_KEY_ESC:
+    case OF_KEY_BACKSPACE:
+        // Back to the reading
+        markedText = conversion.getReading();
+        conversion.cancel();
+        clearCandidates();
+        composerChanged();
+        return true;
+    default:
+        return key.codepoint < 0x20 || key.codepoint == 0x7F;
+    }
+    conversionChanged();
+    return true;
+}
+
+void ofxIMEBase::conversionChanged() {
+    OFXIME_STATS(recordInput());
+    conversion.compose(markedText, markedSelectedLocation, markedSelectedLength);
+    setCandidates(conversion.getCandidates(), conversion.getCandidateIndex());
+    state = Composing;
+}
+
+void ofxIMEBase::composerChanged() {
+    OFXIME_STATS(recordInput());
+    markedSelectedLocation = markedText.length();
+    markedSelectedLength = 0;
+    state = markedText.empty() ? Kana : Composing;
+}
+#endif
+
 // Set conversion candidates
 void ofxIMEBase::setCandidates(const vector<u32string> &cands, int selectedIndex) {
     candidates = cands;
@@ -249,6 +1607,52 @@ void ofxIMEBase::clearCandidates() {
     candidateSelectedIndex = 0;
 }
 
+void ofxIMEBase::insertLines(std::u32string_view str) {
+    lineBreaks.clear();
+    for (size_t i = 0; i < str.length(); ++i) {
+        if (str[i] == U'\n' || str[i] == U'\r') lineBreaks.push_back(i);
+    }
+    insertLines(str, lineBreaks.data(), lineBreaks.size(), 0);
+}
+
+void ofxIMEBase::insertLines(std::u32string_view str, const size_t *breaks, size_t numBreaks, size_t base) {
+    if (str.empty()) return;
+
+    ofxIMEEdit e;
+    e.type = ofxIMEEdit::Insert;
+    e.line = cursorLine;
+    e.pos = cursorPos;
+    e.length = (int)str.length();
+    e.text = str;
+
+    if (numBreaks == 0) {
+        addStr(line[cursorLine], str, cursorPos);
+    }
+    else {
+        // All new lines go into the vector in one move, so a large paste does
+        // not shift the lines below it once per line. The text after the
+        // cursor ends up after the last inserted line
+        std::pmr::u32string tail(line[cursorLine].begin() + cursorPos, line[cursorLine].end(), line.get_allocator());
+        line[cursorLine].erase(cursorPos);
+        line.insert(line.begin() + cursorLine + 1, numBreaks, std::pmr::u32string(line.get_allocator()));
+
+        size_t begin = 0;
+        for (size_t k = 0; k < numBreaks; ++k) {
+            size_t i = breaks[k] - base;
+            line[cursorLine].append(str.substr(begin, i - begin));
+            cursorLine++;
+            begin = i + 1;
+        }
+        line[cursorLine].append(str.substr(begin));
+        cursorPos = (int)line[cursorLine].length();
+        line[cursorLine] += tail;
+    }
+
+    e.endLine = cursorLine;
+    e.endPos = cursorPos;
+    notifyEdit(e);
+}
+
 void ofxIMEBase::deleteSelected() {
     if (!isSelected()) return;
 
@@ -268,30 +1672,40 @@ void ofxIMEBase::deleteSelected() {
     int elen = (int)line[el].length();
     if (elen < en) en = elen;
 
+    // Characters removed, each line break counting as one
+    int length = en - bn;
+    for (int l = bl; l < el; ++l) {
+        length += (int)line[l].length() + 1;
+    }
+
     // Delete within same line or merge lines
-    line[bl] = line[bl].substr(0, bn) + line[el].substr(en, elen - en);
+    if (bl == el) {
+        line[bl].erase(bn, en - bn);
+    }
+    else {
+        line[bl].erase(bn);
+        line[bl].append(line[el], en, elen - en);
 
-    // Delete intermediate lines
-    int delNum = el - bl;
-    for (int i = 0; i < delNum; ++i) {
-        line.erase(line.begin() + bl + 1);
+        // Delete intermediate lines
+        line.erase(line.begin() + bl + 1, line.begin() + el + 1);
     }
 
     cursorLine = bl;
     cursorPos = bn;
     selectCancel();
+
+    ofxIMEEdit e;
+    e.type = ofxIMEEdit::Erase;
+    e.line = bl;
+    e.pos = bn;
+    e.endLine = el;
+    e.endPos = en;
+    e.length = length;
+    notifyEdit(e);
 }
 
 void ofxIMEBase::newLine() {
-    // Insert new line
-    line.insert(line.begin() + cursorLine + 1, U"");
-    // Move text after cursor to new line
-    line[cursorLine + 1] = line[cursorLine].substr(cursorPos, line[cursorLine].length() - cursorPos);
-    // Truncate current line at cursor
-    line[cursorLine] = line[cursorLine].substr(0, cursorPos);
-
-    cursorLine++;
-    cursorPos = 0;
+    insertLines(U"\n");
 }
 
 void ofxIMEBase::lineChange(int n) {
@@ -302,15 +1716,15 @@ void ofxIMEBase::lineChange(int n) {
     }
 }
 
-void ofxIMEBase::addStr(u32string &target, const u32string &str, int &p) {
-    // Insert at cursor position
-    target = target.substr(0, p) + str + target.substr(p, target.length() - p);
+void ofxIMEBase::addStr(std::pmr::u32string &target, std::u32string_view str, int &p) {
+    // Insert at cursor position (in place, grows only when capacity runs out)
+    target.insert(p, str);
 
     // Move cursor
     p += str.length();
 }
 
-void ofxIMEBase::backspaceCharacter(u32string &str, int &pos, bool lineMerge) {
+void ofxIMEBase::backspaceCharacter(std::pmr::u32string &str, int &pos, bool lineMerge) {
     // If cursor at beginning, merge with previous line
     if (pos == 0) {
         if (lineMerge && cursorLine > 0) {
@@ -318,6 +1732,15 @@ void ofxIMEBase::backspaceCharacter(u32string &str, int &pos, bool lineMerge) {
             line[cursorLine - 1] += line[cursorLine];
             line.erase(line.begin() + cursorLine);
             cursorLine--;
+
+            ofxIMEEdit e;
+            e.type = ofxIMEEdit::Erase;
+            e.line = cursorLine;
+            e.pos = cursorPos;
+            e.endLine = cursorLine + 1;
+            e.endPos = 0;
+            e.length = 1;
+            notifyEdit(e);
         }
     }
     // Delete character before cursor
@@ -325,14 +1748,22 @@ void ofxIMEBase::backspaceCharacter(u32string &str, int &pos, bool lineMerge) {
         if ((int)str.length() < pos) pos = (int)str.length();
 
         // Delete character at cursor position
-        str = str.substr(0, pos - 1) + str.substr(pos, str.length() - pos);
+        str.erase(pos - 1, 1);
 
         // Move cursor back
         pos--;
+
+        ofxIMEEdit e;
+        e.type = ofxIMEEdit::Erase;
+        e.line = e.endLine = cursorLine;
+        e.pos = pos;
+        e.endPos = pos + 1;
+        e.length = 1;
+        notifyEdit(e);
     }
 }
 
-void ofxIMEBase::deleteCharacter(u32string &str, int &pos, bool lineMerge) {
+void ofxIMEBase::deleteCharacter(std::pmr::u32string &str, int &pos, bool lineMerge) {
     if ((int)str.length() < pos) {
         pos = (int)str.length();
     }
@@ -341,11 +1772,28 @@ void ofxIMEBase::deleteCharacter(u32string &str, int &pos, bool lineMerge) {
         if (lineMerge && cursorLine + 1 < (int)line.size()) {
             line[cursorLine] += line[cursorLine + 1];
             line.erase(line.begin() + cursorLine + 1);
+
+            ofxIMEEdit e;
+            e.type = ofxIMEEdit::Erase;
+            e.line = cursorLine;
+            e.pos = pos;
+            e.endLine = cursorLine + 1;
+            e.endPos = 0;
+            e.length = 1;
+            notifyEdit(e);
         }
     }
     else {
         // Delete character at cursor position
-        str = str.substr(0, pos) + str.substr(pos + 1, str.length() - pos - 1);
+        str.erase(pos, 1);
+
+        ofxIMEEdit e;
+        e.type = ofxIMEEdit::Erase;
+        e.line = e.endLine = cursorLine;
+        e.pos = pos;
+        e.endPos = pos + 1;
+        e.length = 1;
+        notifyEdit(e);
     }
 }
 
@@ -380,8 +1828,14 @@ string ofxIMEBase::UTF32toSjis(u32string srcu32str) {
 #endif
 
 // UTF-32 to UTF-8 conversion
-string ofxIMEBase::UTF32toUTF8(const u32string &u32str) {
+string ofxIMEBase::UTF32toUTF8(std::u32string_view u32str) {
     string result;
+    UTF32toUTF8(u32str, result);
+    return result;
+}
+
+void ofxIMEBase::UTF32toUTF8(std::u32string_view u32str, string &result) {
+    result.clear();
     for (char32_t c : u32str) {
         if (c < 0x80) {
             result += static_cast<char>(c);
@@ -402,7 +1856,7 @@ string ofxIMEBase::UTF32toUTF8(const u32string &u32str) {
             result += static_cast<char>(0x80 | (c & 0x3F));
         }
     }
-    return result;
+    OFXIME_STATS(ofxIMEStats::transcodedToUTF8.fetch_add(result.size(), std::memory_order_relaxed));
 }
 
 string ofxIMEBase::UTF32toUTF8(const char32_t &u32char) {
@@ -412,6 +1866,12 @@ string ofxIMEBase::UTF32toUTF8(const char32_t &u32char) {
 // UTF-8 to UTF-32 conversion
 u32string ofxIMEBase::UTF8toUTF32(const string &str) {
     u32string result;
+    UTF8toUTF32(str, result);
+    return result;
+}
+
+void ofxIMEBase::UTF8toUTF32(std::string_view str, u32string &result) {
+    result.clear();
     size_t i = 0;
     while (i < str.size()) {
         unsigned char c = str[i];
@@ -420,6 +1880,10 @@ u32string ofxIMEBase::UTF8toUTF32(const string &str) {
             cp = c;
             i += 1;
         }
+        else if (i + ((c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : 4) > str.size()) {
+            // Sequence cut off at the end
+            break;
+        }
         else if ((c & 0xE0) == 0xC0) {
             cp = (c & 0x1F) << 6;
             cp |= (str[i + 1] & 0x3F);
@@ -440,5 +1904,22 @@ u32string ofxIMEBase::UTF8toUTF32(const string &str) {
         }
         result += cp;
     }
-    return result;
+    OFXIME_STATS(ofxIMEStats::transcodedToUTF32.fetch_add(result.size() * sizeof(char32_t), std::memory_order_relaxed));
+}
+
+void ofxIMEBase::UTF16toUTF32(std::u16string_view str, u32string &result) {
+    result.clear();
+    result.reserve(str.size());
+    for (size_t i = 0; i < str.size(); ++i) {
+        char32_t c = str[i];
+        if (c >= 0xD800 && c <= 0xDBFF) {
+            if (i + 1 < str.size() && str[i + 1] >= 0xDC00 && str[i + 1] <= 0xDFFF) {
+                result += 0x10000 + ((c - 0xD800) << 10) + (str[++i] - 0xDC00);
+            }
+        }
+        else if (c < 0xDC00 || c > 0xDFFF) {
+            result += c;
+        }
+    }
+    OFXIME_STATS(ofxIMEStats::transcodedToUTF32.fetch_add(result.size() * sizeof(char32_t), std::memory_order_relaxed));
 }
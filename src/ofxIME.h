@@ -1,6 +1,11 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <memory_resource>
+#include <atomic>
+#include <deque>
+#include <thread>
 
 // OS固有のヘッダ
 #ifdef WIN32
@@ -12,34 +17,224 @@
 #endif
 
 #include "ofMain.h"
+#include "ofxIMEMemory.h"
+#include "ofxIMEStats.h"
+#include "ofxIMETrace.h"
+#include "ofxIMEFontTraits.h"
+#include "ofxIMEFontRegistry.h"
+#include "ofxIMECompletion.h"
+#include "ofxIMERomaji.h"
+#include "ofxIMEDictionary.h"
+#include "ofxIMESpans.h"
+#include "ofxIMENormalizer.h"
+#include "ofxIMEOffsetIndex.h"
 using namespace std;
 
+// 確定済み文字列への編集1回分（ofxIMEBase::editEventで通知される）
+// 位置は行番号と行内の文字位置（UTF-32単位）
+struct ofxIMEEdit {
+    enum Type {
+        Insert,     // (line, pos)にtextを挿入。挿入後の末尾が(endLine, endPos)
+        Erase,      // 編集前の座標で(line, pos)から(endLine, endPos)までを削除
+        Replace,    // 複数の行の中をまとめて置き換え（normalize）。行ごとの内容はhunks
+        Reset       // 内容全体の置き換え（clear, loadSnapshot）。新しい内容は文書から読む
+    };
+    // Replaceの1行分。line行目のposからerased文字をtextに置き換えた（行数は変わらない）
+    struct Hunk {
+        int line = 0;
+        int pos = 0;
+        int erased = 0;
+        std::u32string_view text;
+    };
+    Type type = Insert;
+    int line = 0;               // Replaceでは最初と最後のhunkの行
+    int pos = 0;
+    int endLine = 0;
+    int endPos = 0;
+    int length = 0;             // 挿入・削除した文字数（改行は1文字）
+    std::u32string_view text;   // Insertのみ。通知中だけ有効
+    const Hunk *hunks = nullptr;    // Replaceのみ。行の昇順。通知中だけ有効
+    size_t numHunks = 0;
+};
+
 // 前方宣言（非テンプレートベースクラス）
 class ofxIMEBase {
 public:
-    ofxIMEBase() {
+    // resourceは確定済み文字列（line）の確保先。省略時はデフォルトのヒープ
+    explicit ofxIMEBase(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : documentResource(resource), line(&documentResource), frameArena(std::pmr::new_delete_resource()) {
         ofSetEscapeQuitsApp(false);
         state = Eisu;
         clear();
     }
-    virtual ~ofxIMEBase() = default;
+    virtual ~ofxIMEBase();
 
     void enable();
     void disable();
     void clear();
 
+    // ドキュメントの確保先を差し替える（既存の内容は新しいresourceにコピーされる）
+    void setMemoryResource(std::pmr::memory_resource *resource);
+    std::pmr::memory_resource *getMemoryResource() const { return documentResource.getUpstream(); }
+
+    // メモリ確保の統計（フレーム単位の値は直前のdraw()のもの）
+    struct AllocationStats {
+        size_t documentAllocations = 0;    // ドキュメント領域の累計確保回数
+        size_t documentBytesInUse = 0;     // ドキュメント領域の使用中バイト数
+        size_t frameArenaBytes = 0;        // フレームアリーナから取った一時領域のバイト数
+        size_t frameArenaCapacity = 0;     // フレームアリーナの初期バッファサイズ
+        size_t frameHeapAllocations = 0;   // 1フレーム中に発生したヒープ確保（定常状態では0）
+    };
+    AllocationStats getAllocationStats() const;
+
+    // 処理時間などの計測値（OFXIME_ENABLE_STATSが0のときは常に空）
+    ofxIMEStats getStats() const;
+    void resetStats();
+    void drawStats(float x, float y) const;
+
     bool isEnabled() { return enabled; }
+
+    // カーソルを点滅させるか（falseで常に表示。画像で比べるテストなど、時刻によらない描画用）
+    void setCursorBlink(bool blink) { cursorBlink = blink; }
     bool isJapaneseMode() { return state == Kana || state == Composing; }
 
+    // 入力モードの切り替え（OFXIME_BUILTIN_COMPOSERのとき。OSのIMEがある環境ではOSに従う）
+    // Ctrl+Spaceでも切り替わる。かなモードを抜けるときは未確定文字列を確定する
+    void setJapaneseMode(bool japanese);
+
+    // 組み込みのかな漢字変換の辞書（OFXIME_BUILTIN_COMPOSERのとき）
+    // 変換中: Space/↓ 次の候補、↑ 前の候補、←→ 文節の移動、Shift+←→ 文節の伸縮、
+    // Return 確定、Esc/Backspace 読みに戻す
+    void setDictionary(ofxIMEDictionary *dict) { dictionary = dict; }
+
     // u32stringで内部保持し、getStringでUTF-8に変換して返す
     string getString();
     void setString(const string &str);
     u32string getU32String();
+
+    // 今の文字列との差分だけを編集して置き換える（外部のデータと毎フレーム同期する用）
+    // setStringと違い、カーソル・選択範囲・未確定文字列・装飾は編集に合わせて残る
+    // 同じ文字列なら比較1回で終わる。行の差分はMyersのアルゴリズム、
+    // 変わった行の中は前後の一致部分を除いた範囲だけを書き換える
+    void updateString(const string &str);
+    void updateString(std::u32string_view str);
+
+    // 大きな文字列を数フレームに分けて挿入する（呼んだ時点のカーソル位置へ）
+    // UTF-8の変換と行分けはワーカースレッドで行い、update()ごとに時間を区切って少しずつ入れる
+    // 挿入中も文書は常に整合していて編集もできる。挿入済みの部分はひとまとまりの範囲として
+    // 編集に合わせて動き、cancelPaste(true)で取り消せる（範囲の中で後から編集した部分は残る）
+    // 改行（CRLF, CR）はCtrl+Vの同期の貼り付けと同じく'\n'にそろえる
+    // Ctrl+Vの貼り付けも、setPasteThreshold()のバイト数以上ならこれを使う
+    void insertAsync(string str);
+    bool isPasting() const { return !pastes.empty(); }
+    float getPasteProgress() const;     // 今の貼り付けの進み具合（0-1）
+    bool getPasteRange(int &beginLine, int &beginPos, int &endLine, int &endPos) const;   // 挿入済みの範囲
+    void cancelPaste(bool revert = false);  // revert: 挿入済みの部分も消す（後から編集した部分は残す）
+    void setPasteBudget(float millis) { pasteBudgetMillis = millis; }     // 1回のupdateで挿入に使う時間
+    void setPasteThreshold(size_t bytes) { pasteThreshold = bytes; }
+
+    // 末尾への追記（ログの表示用）。カーソル・選択範囲・未確定文字列は動かさない
+    // かかる時間は追記する長さに比例し、文書の大きさにはよらない。改行はCRLF・CRも1つの改行
+    // 行数の上限を超える分は先頭の古い行から捨て、捨てた行のバッファを新しい行に使い回す
+    void append(const string &str);
+    void append(std::u32string_view str);
+    void setMaxLines(int n);            // 0で上限なし。今の行数が多ければすぐに捨てる
+    int getMaxLines() const { return maxLines; }
+    // これまでに先頭から捨てた行の数。今の先頭の行が、捨て始める前から数えて何行目か
+    // 行番号で位置を持つ側（スクロール位置など）は、増えた分だけずらせばよい
+    uint64_t getDroppedLines() const { return droppedLines; }
+
+    // 確定済み文字列をその場で正規化する（flagsはofxIMENormalizer::Flagsの組み合わせ）
+    // 大きな文書は行ごとに分けてスレッドプールで並列に処理する
+    // 変わった行をまとめて1回のReplaceとして通知する（hunkは行ごとの変わった部分）
+    // （装飾・カーソル・貼り付け中の範囲は文字に合わせて動き、貼り付けも続く）
+    bool normalize(int flags = ofxIMENormalizer::NFKC);
+
     string getLine(int l);
     string getLineSubstr(int l, int begin, int end);
     string getMarkedText();
     string getMarkedTextSubstr(int begin, int end);
 
+    int getNumLines() const { return (int)line.size(); }
+    int getLineLength(int l) const;
+
+    // 範囲[(beginLine, beginPos), (endLine, endPos))の書き出し。行の区切りは'\n'
+    // 位置は文書内に丸めるので、文書全体は(0, 0, INT_MAX, INT_MAX)
+    // 途中で文字列を作らず、行の中身から直接エンコードする
+    // 長さの単位はUTF-8がバイト、UTF-16が16bit、UTF-32が文字
+    size_t getRangeLengthUTF8(int beginLine, int beginPos, int endLine, int endPos) const;
+    size_t getRangeLengthUTF16(int beginLine, int beginPos, int endLine, int endPos) const;
+    size_t getRangeLengthUTF32(int beginLine, int beginPos, int endLine, int endPos) const;
+
+    // 出力イテレータへ（ポインタ、back_inserterなど）。書き終えた位置を返す
+    template<typename OutputIt>
+    OutputIt copyRangeUTF8(int beginLine, int beginPos, int endLine, int endPos, OutputIt out) const {
+        forEachRangePart(beginLine, beginPos, endLine, endPos, [&](std::u32string_view s) {
+            for (char32_t c : s) out = encodeUTF8(c, out);
+        });
+        return out;
+    }
+    template<typename OutputIt>
+    OutputIt copyRangeUTF16(int beginLine, int beginPos, int endLine, int endPos, OutputIt out) const {
+        forEachRangePart(beginLine, beginPos, endLine, endPos, [&](std::u32string_view s) {
+            for (char32_t c : s) out = encodeUTF16(c, out);
+        });
+        return out;
+    }
+    template<typename OutputIt>
+    OutputIt copyRangeUTF32(int beginLine, int beginPos, int endLine, int endPos, OutputIt out) const {
+        forEachRangePart(beginLine, beginPos, endLine, endPos, [&](std::u32string_view s) {
+            out = std::copy(s.begin(), s.end(), out);
+        });
+        return out;
+    }
+
+    // 呼び出し側の固定長バッファへ。必要な長さを返し、capacityが足りなければ何も書かない
+    size_t copyRangeUTF8(int beginLine, int beginPos, int endLine, int endPos, char *dst, size_t capacity) const;
+    size_t copyRangeUTF16(int beginLine, int beginPos, int endLine, int endPos, char16_t *dst, size_t capacity) const;
+    size_t copyRangeUTF32(int beginLine, int beginPos, int endLine, int endPos, char32_t *dst, size_t capacity) const;
+
+    // 使い回す文字列へ（dstを上書きする。容量が足りていれば確保しない）
+    void getRangeUTF8(int beginLine, int beginPos, int endLine, int endPos, string &dst) const;
+    void getRangeUTF16(int beginLine, int beginPos, int endLine, int endPos, std::u16string &dst) const;
+    void getRangeUTF32(int beginLine, int beginPos, int endLine, int endPos, u32string &dst) const;
+
+    // 1文字のエンコード
+    template<typename OutputIt>
+    static OutputIt encodeUTF8(char32_t c, OutputIt out) {
+        if (c < 0x80) {
+            *out++ = static_cast<char>(c);
+        }
+        else if (c < 0x800) {
+            *out++ = static_cast<char>(0xC0 | (c >> 6));
+            *out++ = static_cast<char>(0x80 | (c & 0x3F));
+        }
+        else if (c < 0x10000) {
+            *out++ = static_cast<char>(0xE0 | (c >> 12));
+            *out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (c & 0x3F));
+        }
+        else {
+            *out++ = static_cast<char>(0xF0 | (c >> 18));
+            *out++ = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            *out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (c & 0x3F));
+        }
+        return out;
+    }
+    template<typename OutputIt>
+    static OutputIt encodeUTF16(char32_t c, OutputIt out) {
+        if (c < 0x10000) {
+            *out++ = static_cast<char16_t>(c);
+        }
+        else {
+            c -= 0x10000;
+            *out++ = static_cast<char16_t>(0xD800 | (c >> 10));
+            *out++ = static_cast<char16_t>(0xDC00 | (c & 0x3FF));
+        }
+        return out;
+    }
+
     // IMEから受け取った文字列を挿入（OSからのコールバック用）
     void insertText(const u32string &str);
     void setMarkedTextFromOS(const u32string &str, int selectedLocation, int selectedLength);
@@ -53,9 +248,60 @@ public:
     // テンプレートサブクラスでオーバーライド
     virtual ofVec2f getMarkedTextScreenPosition() { return lastDrawPos; }
 
-    static string UTF32toUTF8(const u32string &u32str);
+    // 確定済み文字列が変わるたびに、変更後に通知される
+    ofEvent<ofxIMEEdit> editEvent;
+
+    // カーソル位置（行, 行内の文字位置）
+    int getCursorLine() const { return cursorLine; }
+    int getCursorPos() const { return cursorPos; }
+    void setCursor(int line, int pos);
+
+    // 位置を指定した編集（カーソルは編集位置に移動する）
+    void insertAt(int line, int pos, std::u32string_view str);
+    void eraseRange(int beginLine, int beginPos, int endLine, int endPos);
+
+    // 状態のスナップショット（文字列・カーソル・選択範囲・入力状態・未確定文字列・変換候補）
+    // バージョン付きのバイナリ形式（ホストのバイト順）。UTF-32のままコピーするので変換しない
+    // dstを使い回せば確保は起きない
+    // OFXIME_BUILTIN_COMPOSERのときは、変換の途中の状態を持たないので未確定文字列と変換候補は復元しない
+    void saveSnapshot(ofBuffer &dst) const;
+    bool loadSnapshot(const char *data, size_t size);
+    bool loadSnapshot(const ofBuffer &src) { return loadSnapshot(src.getData(), src.size()); }
+
+    // 入力補完（nullptrで無効）。確定した語句を学習し、カーソル直前の語に続く候補を
+    // 変換候補のリストに混ぜて表示する。未確定文字列がないときはTabで先頭の候補を確定
+    void setCompletion(ofxIMECompletion *c, int maxResults = 5);
+    const vector<u32string> &getCompletions() const { return completions; }
+
+    // 文字列の装飾（色・背景・下線）。範囲は(行, 行内の文字位置)で指定し、戻り値のidで外す
+    // 範囲は編集に合わせて動く（前で挿入・削除すればずれ、範囲内で挿入すれば伸びる）
+    // clear()やloadSnapshot()で全体が置き換わると消える
+    int addSpan(int beginLine, int beginPos, int endLine, int endPos, const ofxIMESpanStyle &style);
+    bool removeSpan(int id) { return spans.remove(id); }
+    void clearSpans() { spans.clear(); }
+    ofxIMESpans &getSpans() { return spans; }
+
+    // (行, 行内の文字位置)を文書先頭からの文字数にする（改行は1文字）。下の索引を使うのでO(log 行数)
+    int getOffset(int line, int pos) const;
+
+    // 位置の単位の変換（OSのIMEはUTF-16、アプリはUTF-8のバイト数で位置を持つことが多い）
+    // offsetは文書先頭からのunit単位の位置（改行は1単位）、posは行内の文字位置
+    // 行ごとの長さの索引を最初に使ったときに作り、以後は編集に合わせて直すので行の検索はO(log 行数)
+    // 行の中は数えるだけで、ASCIIだけ・BMPだけの行はそれもしない。文字の途中を指す位置はその文字の先頭
+    size_t getOffset(int line, int pos, ofxIMEOffsetIndex::Unit unit) const;
+    void getPosition(size_t offset, ofxIMEOffsetIndex::Unit unit, int &line, int &pos) const;
+    size_t convertOffset(size_t offset, ofxIMEOffsetIndex::Unit from, ofxIMEOffsetIndex::Unit to) const;
+    // 選択範囲（なければカーソル位置の空の範囲）
+    void getSelectionOffsets(ofxIMEOffsetIndex::Unit unit, size_t &begin, size_t &end) const;
+
+    static string UTF32toUTF8(std::u32string_view u32str);
     static string UTF32toUTF8(const char32_t &u32char);
+    // dstを上書きして変換する（容量が足りていれば確保しない）
+    static void UTF32toUTF8(std::u32string_view u32str, string &dst);
     static u32string UTF8toUTF32(const string &str);
+    static void UTF8toUTF32(std::string_view str, u32string &dst);
+    // 対になっていないサロゲートは捨てる
+    static void UTF16toUTF32(std::u16string_view str, u32string &dst);
 
 protected:
     bool enabled = false;
@@ -70,8 +316,33 @@ protected:
     vector<u32string> candidates;
     int candidateSelectedIndex = 0;
 
+    // 入力補完の候補（draw()の先頭で必要なときだけ引き直す）
+    ofxIMECompletion *completion = nullptr;
+    int maxCompletions = 5;
+    vector<u32string> completions;
+    int completionPrefixLength = 0;     // 候補の先頭のうち入力済みの文字数
+    u32string completionQuery;          // 直前に引いたときのカーソル直前の文字列
+    uint64_t completionRevision = 0;
+    void updateCompletions();
+    bool acceptCompletion();
+
+    // 文字列の装飾（位置は文書先頭からの文字数）
+    ofxIMESpans spans;
+
+    // 単位の変換用の索引（最初に使うときに作る。作った後はnotifyEditで直す）
+    mutable ofxIMEOffsetIndex offsetIndex;
+    const ofxIMEOffsetIndex &getOffsetIndex() const;
+
+    // 確定済み文字列の確保先（確保回数を数えるためラッパーを挟む）
+    ofxIMECountingResource documentResource;
+
     // 確定済み文字列
-    vector<u32string> line; // 各行の文字列をvectorで持つ
+    // 各行の文字列をdequeで持つ（先頭の行を捨てても残りの行を動かさない）
+    std::pmr::deque<std::pmr::u32string> line;
+
+    // draw()中の一時領域（draw()の先頭でreset）
+    // 文書の確保先とは別のヒープから取るので、ドキュメント領域の統計には入らない
+    ofxIMEFrameArena frameArena;
 
     // 選択範囲
     typedef tuple<int, int> TextSelectPos;
@@ -88,9 +359,76 @@ protected:
     }
     void deleteSelected();
 
+    // 範囲を文書内に丸め、逆順なら入れ替える
+    void clampRange(int &beginLine, int &beginPos, int &endLine, int &endPos) const;
+
+    // 範囲を行の中身と改行の部分ごとにfに渡す
+    template<typename F>
+    void forEachRangePart(int beginLine, int beginPos, int endLine, int endPos, F &&f) const {
+        clampRange(beginLine, beginPos, endLine, endPos);
+        for (int l = beginLine; l <= endLine; ++l) {
+            std::u32string_view s = line[l];
+            size_t b = l == beginLine ? beginPos : 0;
+            size_t e = l == endLine ? endPos : s.size();
+            f(s.substr(b, e - b));
+            if (l < endLine) f(std::u32string_view(U"\n", 1));
+        }
+    }
+
+    // updateString()の作業領域（使い回す）
+    struct LineHunk { int oldBegin, oldEnd, newBegin, newEnd; };
+    u32string updateText;
+    vector<std::u32string_view> updateLines;
+    vector<size_t> oldLineHashes, newLineHashes;
+    vector<int> myersTrace;
+    vector<LineHunk> updateHunks;
+    u32string hunkOld, hunkNew;
+    void diffLines(int prefix, int oldEnd, int newEnd);
+    void replaceHunk(const LineHunk &h);
+
+    // normalize()の作業領域（行ごとの結果。ワーカースレッドが書く。使い回す）
+    vector<u32string> normalizeOut;
+    vector<uint8_t> normalizeChanged;
+    u32string normalizePrefix;
+    vector<ofxIMEEdit::Hunk> normalizeHunks;
+
+    // insertAsync()の1件分。先頭が挿入中で、後ろは順番待ち
+    struct PasteJob {
+        std::thread worker;
+        std::atomic<bool> ready{false};     // textができた
+        std::atomic<bool> cancelled{false};
+        string utf8;
+        u32string text;                     // 改行は'\n'にそろえてある
+        vector<size_t> breaks;              // textの改行の位置（行分けもワーカースレッドで済ませる）
+        size_t inserted = 0;                // 文書に入れ終えた文字数
+        size_t insertedBreaks = 0;          // 文書に入れ終えた改行の数
+        int beginLine = 0, beginPos = 0;    // 挿入済みの範囲（編集に合わせて動く）
+        int endLine = 0, endPos = 0;
+        ~PasteJob();
+    };
+    std::deque<std::unique_ptr<PasteJob>> pastes;
+    PasteJob *pasteInserting = nullptr;     // 挿入中の通知ではこの範囲は動かさない
+    float pasteBudgetMillis = 4;
+    size_t pasteThreshold = 1 << 20;
+    static void decodePaste(PasteJob &job);
+    void updatePaste(ofEventArgs &args);
+    void insertPasteChunk(PasteJob &job, size_t end);   // textの[inserted, end)を入れる
+    void revertPaste(PasteJob &job);
+
+    // append()の作業領域と行数の上限
+    u32string appendText;
+    vector<std::pmr::u32string> spareLines;     // 捨てた行。中身を消して追記する行に使う
+    int maxLines = 0;
+    uint64_t droppedLines = 0;
+    void dropFirstLines(int n, size_t spare);
+
     // 改行して新しい行を作る
     void newLine();
 
+    void notifyEdit(ofxIMEEdit &e);
+    // Replaceで装飾を動かすための作業領域（hunkの行の編集前の先頭位置と、そこまでのずれ）
+    vector<pair<int, int>> replaceStarts;
+
     // 行の移動
     void lineChange(int n);
 
@@ -99,11 +437,19 @@ protected:
     int cursorPos;  // 行内の何文字目か
 
     // 指定した位置に文字列を挿入する関数
-    void addStr(u32string &target, const u32string &str, int &p);
+    void addStr(std::pmr::u32string &target, std::u32string_view str, int &p);
+
+    // 改行を含む文字列をカーソル位置に挿入する
+    void insertLines(std::u32string_view str);
+    // 改行の位置が分かっている場合（breaks[k] - baseがstr内の改行の位置。昇順）
+    void insertLines(std::u32string_view str, const size_t *breaks, size_t numBreaks, size_t base);
+    vector<size_t> lineBreaks;      // insertLines()の作業領域
+    // ユーザーが確定した文字列の挿入（入力補完が学習するのはここだけ）
+    void commitText(std::u32string_view str);
 
     // カーソル位置の文字を削除する関数
-    void backspaceCharacter(u32string &str, int &pos, bool lineMerge = false);
-    void deleteCharacter(u32string &str, int &pos, bool lineMerge = false);
+    void backspaceCharacter(std::pmr::u32string &str, int &pos, bool lineMerge = false);
+    void deleteCharacter(std::pmr::u32string &str, int &pos, bool lineMerge = false);
 
 #ifdef WIN32
     // 内部処理用のUTF-32 → Shift-JIS に変換する関数（Windowsのみ必要）
@@ -126,6 +472,18 @@ protected:
     // キーボードイベントのハンドラ
     void keyPressed(ofKeyEventArgs &key);
 
+    ofxIMEDictionary *dictionary = nullptr;
+
+#if OFXIME_BUILTIN_COMPOSER
+    // OSのIMEの代わりにキー入力からmarkedTextを作る
+    ofxIMERomajiComposer composer;
+    ofxIMEConversion conversion;
+    bool composeKey(ofKeyEventArgs &key);
+    bool convertKey(ofKeyEventArgs &key);
+    void composerChanged();
+    void conversionChanged();
+#endif
+
 #ifdef __APPLE__
     static void onInputSourceChanged(CFNotificationCenterRef center,
                                      void *observer,
@@ -153,31 +511,67 @@ protected:
 
     // カーソルの点滅タイミング用
     float cursorBlinkOffsetTime;
+    bool cursorBlink = true;
 
     // 変換候補表示位置のアニメーション (0-1)
     float movingY;
+
+#if OFXIME_ENABLE_STATS
+    ofxIMEStats stats;
+    uint64_t pendingInputMicros = 0;    // 描画待ちの入力を受け取った時刻
+    size_t documentAllocationsAtReset = 0;  // resetStats()の時点のドキュメント領域の確保回数
+    void recordInput();
+    void recordFrame(int linesLaidOut);
+#endif
 };
 
 // テンプレート化されたメインクラス
 template<typename FontType = ofTrueTypeFont>
 class ofxIME : public ofxIMEBase {
 public:
-    ofxIME() {}
+    using Traits = ofxIMEFontTraits<FontType>;
+
+    explicit ofxIME(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : ofxIMEBase(resource) {}
     ~ofxIME() {}
 
     // フォント設定
     void setFont(string path, float fontSize) {
-        ofTrueTypeFontSettings settings(path, fontSize);
-        settings.addRanges(ofAlphabet::Latin);
-        settings.addRanges(ofAlphabet::Japanese);
-        settings.addRange(ofUnicode::KatakanaHalfAndFullwidthForms);
-        settings.addRange(ofUnicode::range{0x3000, 0x303F}); // CJK symbols and punctuation
-        font.load(settings);
+        font.load(defaultFontSettings(path, fontSize));
         fontPtr = nullptr;  // 自前フォントを使用
+        registryFont.reset();
     }
 
     void setFont(FontType* sharedFont) {
         fontPtr = sharedFont;
+        registryFont.reset();
+    }
+
+    // プロセス共通のレジストリからフォントを借りる
+    // 同じパス・サイズの指定は全インスタンスで1つのフォントを共有し、
+    // 読み込みはsetup()を止めずに行う（読み込み完了までdraw()は何も描かない）
+    void setSharedFont(string path, float fontSize) {
+        registryFont = ofxIMEFontRegistry<FontType>::acquire(defaultFontSettings(path, fontSize));
+        fontPtr = nullptr;
+    }
+
+    void setSharedFont(const ofTrueTypeFontSettings &settings) {
+        registryFont = ofxIMEFontRegistry<FontType>::acquire(settings);
+        fontPtr = nullptr;
+    }
+
+    // レジストリのフォントが読み込み中ならfalse（失敗した場合はtrueを返し、draw()がエラーを出す）
+    bool isFontReady() const {
+        return !registryFont || registryFont->isReady() || registryFont->isFailed();
+    }
+
+    static ofTrueTypeFontSettings defaultFontSettings(string path, float fontSize) {
+        ofTrueTypeFontSettings settings(path, fontSize);
+        settings.addRanges(ofAlphabet::Latin);
+        settings.addRanges(ofAlphabet::Japanese);
+        settings.addRange(ofUnicode::KatakanaHalfAndFullwidthForms);
+        settings.addRange(ofUnicode::range{0x3000, 0x303F}); // CJK symbols and punctuation
+        return settings;
     }
 
     // 描画（確定済み文字列+未確定文字列）
@@ -186,15 +580,35 @@ public:
     }
 
     void draw(float x, float y) {
+        OFXIME_STATS_SCOPE(stats.draw);
+        OFXIME_TRACE_SCOPE("ofxIME draw");
+
+        // Shared font still loading: draw nothing until it is ready
+        if (!isFontReady()) return;
+
         FontType& f = getFont();
         if (!f.isLoaded()) {
             ofLogError("ofxIME") << "font is not loaded.";
             return;
         }
+        if constexpr (Traits::drawTarget) {
+            if (!f.getTarget()) {
+                ofLogError("ofxIME") << "font has no draw target.";
+                return;
+            }
+        }
 
         // Store draw position for mouse click detection
         lastDrawPos = ofVec2f(x, y);
 
+        // Temporaries below come from the frame arena / scratch strings,
+        // so a steady-state frame does not touch the heap
+        frameArena.reset();
+        inFrame = true;
+
+        // Completions follow the text before the cursor; looked up again only when it changed
+        updateCompletions();
+
         // Animation easing effect
         movingY *= 0.7;
 
@@ -202,124 +616,399 @@ public:
         float lineHeight = f.getLineHeight();
         float margin = fontSize * 0.1;
 
+        // Everything is laid out first: the glyph runs, and the decorations under
+        // them (caret, underlines, highlights) as quads that go out in one mesh
+        ofColor textColor;
+        if constexpr (Traits::drawTarget) textColor = f.getTarget()->getColor();
+        else textColor = ofGetStyle().color;
+
+        struct GlyphRun { const string *str; float x, y; ofColor color; };
+        std::pmr::vector<GlyphRun> glyphs(frameArena.resource());
+        std::pmr::vector<DecorationQuad> quads(frameArena.resource());
+
+        auto addQuad = [&](float x0, float y0, float x1, float y1, const ofColor &c) {
+            quads.push_back({x0, y0, x1, y1, c});
+        };
+        // Lines become quads too, so widths do not depend on the GL line width
+        auto addLine = [&](float x0, float x1, float ly, float width, const ofColor &c) {
+            addQuad(x0, ly - width * 0.5f, x1, ly + width * 0.5f, c);
+        };
+
         // Cursor drawing function
-        auto drawCursor = [=, this](float cx, float cy) {
+        auto drawCursor = [&](float cx, float cy) {
             if (!enabled) return;
-            if (fmod(ofGetElapsedTimef() - cursorBlinkOffsetTime, 0.8) < 0.4) {
-                ofSetLineWidth(2);
-                ofDrawLine(cx + 1, cy, cx + 1, cy - fontSize * 1.2);
+            if (!cursorBlink || fmod(ofGetElapsedTimef() - cursorBlinkOffsetTime, 0.8) < 0.4) {
+                addQuad(cx, cy - fontSize * 1.2, cx + 2, cy, textColor);
             }
         };
 
-        ofPushMatrix();
-        ofTranslate(x, y);
+        // Candidate list below the text being entered: the OS candidates, then
+        // completions that are not among them
+        auto drawCandidates = [&](float cx, float cy) {
+            if (candidates.empty() && completions.empty()) return;
+
+            // Highlight the OS selection, or the completion Tab would accept
+            int selected = !candidates.empty() ? candidateSelectedIndex
+                         : markedText.empty() ? 0 : -1;
+
+            float lh = f.getLineHeight();
+            float rowY = cy + lh;
+
+            int total = (int)(candidates.size() + completions.size());
+            for (int j = 0; j < total; ++j) {
+                bool fromOS = j < (int)candidates.size();
+                const u32string &cand = fromOS ? candidates[j] : completions[j - candidates.size()];
+                if (!fromOS && std::find(candidates.begin(), candidates.end(), cand) != candidates.end()) {
+                    continue;
+                }
+                string &candStr = frameArena.scratch();
+                UTF32toUTF8(cand, candStr);
+
+                if (j == selected) {
+                    // Highlight selected candidate with background
+                    float candW = measureWidthUTF8(f, cand, candStr);
+                    addQuad(cx - 2, rowY - fontSize, cx + candW + 2, rowY - fontSize + lh, ofColor(100, 150));
+                }
+
+                glyphs.push_back({&candStr, cx, rowY, textColor});
+                rowY += lh;
+            }
+        };
+
+        // Confirmed text, split into runs where the spans over it change style:
+        // backgrounds and underlines become quads, and each text color one run
+        std::pmr::vector<ofxIMESpan> lineSpans(frameArena.resource());
+        std::pmr::vector<int> cuts(frameArena.resource());
+        std::pmr::vector<float> cutX(frameArena.resource());
+        string &measureStr = frameArena.scratch();
+        auto drawText = [&](std::u32string_view text, int offset, const string &utf8, float tx, float ty) {
+            lineSpans.clear();
+            if (spans.size() > 0 && !text.empty()) {
+                spans.query(offset, offset + (int)text.length(), lineSpans);
+            }
+            if (lineSpans.empty()) {
+                glyphs.push_back({&utf8, tx, ty, textColor});
+                return;
+            }
+
+            int len = (int)text.length();
+            cuts.clear();
+            cuts.push_back(0);
+            cuts.push_back(len);
+            for (auto &s : lineSpans) {
+                cuts.push_back(ofClamp(s.begin - offset, 0, len));
+                cuts.push_back(ofClamp(s.end - offset, 0, len));
+            }
+            std::sort(cuts.begin(), cuts.end());
+            cuts.erase(std::unique(cuts.begin(), cuts.end()), cuts.end());
+
+            cutX.clear();
+            for (int c : cuts) {
+                cutX.push_back(tx + measureWidth(f, text.substr(0, c), measureStr));
+            }
+
+            // Where spans overlap, the one added last wins
+            auto styleAt = [&](int p) -> const ofxIMESpanStyle * {
+                const ofxIMESpanStyle *style = nullptr;
+                int id = -1;
+                for (auto &s : lineSpans) {
+                    if (s.begin - offset <= p && p < s.end - offset && s.id > id) {
+                        style = &s.style;
+                        id = s.id;
+                    }
+                }
+                return style;
+            };
+            auto colorAt = [&](int k) {
+                const ofxIMESpanStyle *s = styleAt(cuts[k]);
+                return s && s->color.a > 0 ? s->color : textColor;
+            };
+
+            int pieces = (int)cuts.size() - 1;
+            for (int k = 0; k < pieces; ++k) {
+                const ofxIMESpanStyle *s = styleAt(cuts[k]);
+                if (!s) continue;
+                if (s->background.a > 0) {
+                    addQuad(cutX[k], ty - fontSize, cutX[k + 1], ty - fontSize + lineHeight, s->background);
+                }
+                if (s->underline.a > 0) {
+                    addLine(cutX[k], cutX[k + 1], ty + fontSize * 0.2, 1, s->underline);
+                }
+            }
+
+            // Neighbouring pieces of the same color are drawn together
+            for (int k = 0; k < pieces;) {
+                ofColor color = colorAt(k);
+                int next = k + 1;
+                while (next < pieces && colorAt(next) == color) next++;
+                string &runStr = frameArena.scratch();
+                UTF32toUTF8(text.substr(cuts[k], cuts[next] - cuts[k]), runStr);
+                glyphs.push_back({&runStr, cutX[k], ty, color});
+                k = next;
+            }
+        };
+
+        // Lines dropped from the top since the mesh was built only move the
+        // rest up, so the layout stays in that frame's coordinates and is
+        // translated back; the mesh is rebased now and then to keep them small
+        if (droppedLines - decorationBase > 1024) decorationBase = droppedLines;
+        int shift = (int)(droppedLines - decorationBase);
+
+        int lineOffset = 0;
 
         for (int i = 0; i < (int)line.size(); ++i) {
+            float lineY = (i + shift) * lineHeight;
+
             // Check if this is the current input line
             if (i != cursorLine) {
                 // Non-active line
-                f.drawString(UTF32toUTF8(line[i]), 0, 0);
+                string &lineStr = frameArena.scratch();
+                UTF32toUTF8(line[i], lineStr);
+                drawText(line[i], lineOffset, lineStr, 0, lineY);
             }
             else {
                 // Current input line
-                ofPushMatrix();
+                std::u32string_view cur = line[cursorLine];
+                float penX = 0;
 
                 // Confirmed text before cursor
-                string beforeCursor = getLineSubstr(cursorLine, 0, cursorPos);
-                f.drawString(beforeCursor, 0, 0);
-                float beforeW = f.stringWidth(beforeCursor);
-
-                ofTranslate(beforeW, 0);
+                string &beforeCursor = frameArena.scratch();
+                UTF32toUTF8(cur.substr(0, cursorPos), beforeCursor);
+                drawText(cur.substr(0, cursorPos), lineOffset, beforeCursor, penX, lineY);
+                penX += measureWidthUTF8(f, cur.substr(0, cursorPos), beforeCursor);
 
                 // If there is marked (composing) text
                 if (markedText.length() > 0) {
-                    ofTranslate(margin, 0);
+                    penX += margin;
 
-                    string markedStr = getMarkedText();
-                    f.drawString(markedStr, 0, 0);
-                    float markedW = f.stringWidth(markedStr);
+                    std::u32string_view marked = markedText;
 
-                    // Draw underlines for marked text segments
-                    // First, draw thin underline for non-selected part (before selection)
-                    string selStart = getMarkedTextSubstr(0, markedSelectedLocation);
-                    float selStartW = f.stringWidth(selStart);
+                    string &markedStr = frameArena.scratch();
+                    UTF32toUTF8(marked, markedStr);
+                    glyphs.push_back({&markedStr, penX, lineY, textColor});
+                    float markedW = measureWidthUTF8(f, marked, markedStr);
+
+                    // First, thin underline for non-selected part (before selection)
+                    float underlineY = lineY + fontSize * 0.2;
+                    float selStartW = measureWidth(f, marked.substr(0, markedSelectedLocation), measureStr);
 
                     if (markedSelectedLength > 0) {
                         // There is a selected range
-                        string selText = getMarkedTextSubstr(markedSelectedLocation, markedSelectedLength);
-                        float selW = f.stringWidth(selText);
+                        float selW = measureWidth(f, marked.substr(markedSelectedLocation, markedSelectedLength), measureStr);
 
                         // Thin underline before selection
                         if (selStartW > 0) {
-                            ofSetLineWidth(1);
-                            ofDrawLine(1, fontSize * 0.2, selStartW - 1, fontSize * 0.2);
+                            addLine(penX + 1, penX + selStartW - 1, underlineY, 1, textColor);
                         }
 
                         // Thick underline for selected part
-                        ofSetLineWidth(3);
-                        ofDrawLine(selStartW + 1, fontSize * 0.2, selStartW + selW - 1, fontSize * 0.2);
+                        addLine(penX + selStartW + 1, penX + selStartW + selW - 1, underlineY, 3, textColor);
 
                         // Thin underline after selection
                         if (selStartW + selW < markedW) {
-                            ofSetLineWidth(1);
-                            ofDrawLine(selStartW + selW + 1, fontSize * 0.2, markedW - 1, fontSize * 0.2);
+                            addLine(penX + selStartW + selW + 1, penX + markedW - 1, underlineY, 1, textColor);
                         }
                     }
                     else {
-                        // No selection, draw thin underline for entire marked text
-                        ofSetLineWidth(1);
-                        ofDrawLine(1, fontSize * 0.2, markedW - 1, fontSize * 0.2);
+                        // No selection, thin underline for entire marked text
+                        addLine(penX + 1, penX + markedW - 1, underlineY, 1, textColor);
                     }
 
                     // Draw conversion candidates
-                    if (candidates.size() > 0) {
-                        float lh = f.getLineHeight();
-                        ofPushMatrix();
-                        ofTranslate(0, lh);  // Display below marked text
-
-                        for (int j = 0; j < (int)candidates.size(); ++j) {
-                            string candStr = UTF32toUTF8(candidates[j]);
-
-                            if (j == candidateSelectedIndex) {
-                                // Highlight selected candidate with background
-                                ofPushStyle();
-                                ofFill();
-                                ofSetColor(100, 150);
-                                float candW = f.stringWidth(candStr);
-                                ofDrawRectangle(-2, -fontSize, candW + 4, lh);
-                                ofPopStyle();
-                            }
-
-                            f.drawString(candStr, 0, 0);
-                            ofTranslate(0, lh);
-                        }
-                        ofPopMatrix();
-                    }
+                    drawCandidates(penX, lineY);
 
-                    ofTranslate(markedW + margin, 0);
+                    penX += markedW + margin;
                 }
                 else {
                     // No marked text - draw cursor
-                    drawCursor(0, 0);
+                    drawCursor(penX, lineY);
+                    drawCandidates(penX, lineY);
                 }
 
                 // Confirmed text after cursor
-                string afterCursor = getLineSubstr(cursorLine, cursorPos, (int)line[cursorLine].length() - cursorPos);
-                f.drawString(afterCursor, 0, 0);
-
-                ofPopMatrix();
+                string &afterCursor = frameArena.scratch();
+                UTF32toUTF8(cur.substr(cursorPos), afterCursor);
+                drawText(cur.substr(cursorPos), lineOffset + cursorPos, afterCursor, penX, lineY);
             }
 
             // Move to next line
-            ofTranslate(0, lineHeight);
+            lineOffset += (int)line[i].length() + 1;
         }
 
-        ofPopMatrix();
+        // Decorations first, in one draw call; the mesh is only rebuilt when they changed
+        updateDecorations(quads);
+
+        if constexpr (Traits::drawTarget) {
+            // Software target: the same calls in the same order, without GL
+            auto &target = *f.getTarget();
+            target.pushTranslate(x, y - shift * lineHeight);
+            if (!decorations.empty()) target.drawQuads(decorations);
+            for (size_t k = 0; k < glyphs.size(); ++k) {
+                if (k == 0 || glyphs[k].color != glyphs[k - 1].color) target.setColor(glyphs[k].color);
+                f.drawString(*glyphs[k].str, glyphs[k].x, glyphs[k].y);
+            }
+            target.setColor(textColor);
+            target.popTranslate();
+        }
+        else {
+            ofPushMatrix();
+            ofTranslate(x, y - shift * lineHeight);
+
+            if (!quads.empty()) decorationMesh.draw();
+
+            ofPushStyle();
+            for (size_t k = 0; k < glyphs.size(); ++k) {
+                if (k == 0 || glyphs[k].color != glyphs[k - 1].color) ofSetColor(glyphs[k].color);
+                f.drawString(*glyphs[k].str, glyphs[k].x, glyphs[k].y);
+            }
+            ofPopStyle();
+
+            ofPopMatrix();
+        }
+
+        inFrame = false;
+        OFXIME_STATS(recordFrame((int)line.size()));
     }
 
     // マウスクリック位置にカーソルを移動
     void setCursorByMouse(float x, float y) {
+        if (!isFontReady()) return;
         FontType& f = getFont();
+
+        if constexpr (Traits::fixedPitch || Traits::batchedAdvances) {
+            // Rows are one line height apart and columns come from the cell
+            // width / advances, so no string has to be measured
+            float top = lastDrawPos.y - f.getSize();
+            int lineNumber = (int)floor((y - top) / f.getLineHeight());
+            if (lineNumber < 0 || lineNumber >= (int)line.size() || x < lastDrawPos.x) return;
+
+            cursorLine = lineNumber;
+            cursorPos = indexAtX(f, line[lineNumber], x - lastDrawPos.x);
+            cursorBlinkOffsetTime = ofGetElapsedTimef();
+        }
+        else {
+            setCursorByMouseMeasured(f, x, y);
+        }
+    }
+
+    // 描画位置のスクリーン座標を返す（IME候補ウィンドウ表示用）
+    ofVec2f getMarkedTextScreenPosition() override {
+        if (!isFontReady()) return lastDrawPos;
+        FontType& f = getFont();
+        float x = lastDrawPos.x;
+        float y = lastDrawPos.y;
+
+        // Calculate Y coordinate for current line
+        y += f.getLineHeight() * cursorLine;
+
+        // Calculate X coordinate for cursor position
+        string beforeCursor;
+        x += measureWidth(f, std::u32string_view(line[cursorLine]).substr(0, cursorPos), beforeCursor);
+
+        return ofVec2f(x, y);
+    }
+
+private:
+    // 文字以外の装飾（カーソル・未確定文字列の下線・候補の強調・装飾範囲の背景と下線）
+    // 四角形のメッシュ1つにまとめて1回で描く。前フレームと同じなら作り直さない
+    struct DecorationQuad {
+        float x0, y0, x1, y1;
+        ofColor color;
+        bool operator==(const DecorationQuad &o) const {
+            return x0 == o.x0 && y0 == o.y0 && x1 == o.x1 && y1 == o.y1 && color == o.color;
+        }
+    };
+    vector<DecorationQuad> decorations;     // decorationMeshの元（次のフレームとの比較用）
+    uint64_t decorationBase = 0;            // 座標の基準にしたgetDroppedLines()の値
+    ofVboMesh decorationMesh;
+
+    template<typename Quads>
+    void updateDecorations(const Quads &quads) {
+        if (std::equal(quads.begin(), quads.end(), decorations.begin(), decorations.end())) return;
+        OFXIME_STATS(stats.decorationRebuilds++);
+
+        decorations.assign(quads.begin(), quads.end());
+        decorationMesh.clear();
+        decorationMesh.setMode(OF_PRIMITIVE_TRIANGLES);
+        for (auto &q : decorations) {
+            ofIndexType base = decorationMesh.getNumVertices();
+            decorationMesh.addVertex(glm::vec3(q.x0, q.y0, 0));
+            decorationMesh.addVertex(glm::vec3(q.x1, q.y0, 0));
+            decorationMesh.addVertex(glm::vec3(q.x1, q.y1, 0));
+            decorationMesh.addVertex(glm::vec3(q.x0, q.y1, 0));
+            for (int k = 0; k < 4; ++k) decorationMesh.addColor(q.color);
+            ofIndexType indices[6] = {base, base + 1, base + 2, base, base + 2, base + 3};
+            decorationMesh.addIndices(indices, 6);
+        }
+    }
+
+    // 計測の一時領域。draw()の中はフレームアリーナ、外（クリック位置・候補ウィンドウの位置）は
+    // 呼び出しごとのヒープ（次のフレームの統計に入れず、アリーナにも残さない）
+    bool inFrame = false;
+    std::pmr::memory_resource *measureResource() {
+        return inFrame ? frameArena.resource() : std::pmr::new_delete_resource();
+    }
+
+    // 幅の計測。FontTypeの能力に応じて最速の方法を選ぶ
+    // utf8はstringWidthで測るときだけ使う作業用バッファ
+    float measureWidth(FontType &f, std::u32string_view str, string &utf8) {
+        if constexpr (Traits::fixedPitch) {
+            return ofxIMEColumns(str) * f.getCellWidth();
+        }
+        else if constexpr (Traits::batchedAdvances) {
+            std::pmr::vector<float> advances(str.size(), measureResource());
+            f.getAdvances(str, advances.data());
+            float w = 0;
+            for (float a : advances) w += a;
+            return w;
+        }
+        else {
+            UTF32toUTF8(str, utf8);
+            return f.stringWidth(utf8);
+        }
+    }
+
+    // utf8にstrの変換結果が既に入っている場合
+    float measureWidthUTF8(FontType &f, std::u32string_view str, const string &utf8) {
+        if constexpr (Traits::fixedPitch || Traits::batchedAdvances) {
+            string unused;
+            return measureWidth(f, str, unused);
+        }
+        else {
+            return f.stringWidth(utf8);
+        }
+    }
+
+    // 行頭からxピクセルの位置に最も近い文字位置
+    int indexAtX(FontType &f, std::u32string_view str, float x) {
+        if constexpr (Traits::fixedPitch) {
+            return ofxIMEIndexAtColumn(str, x / f.getCellWidth());
+        }
+        else if constexpr (Traits::batchedAdvances) {
+            std::pmr::vector<float> advances(str.size(), measureResource());
+            f.getAdvances(str, advances.data());
+            float left = 0;
+            for (int i = 0; i < (int)advances.size(); ++i) {
+                if (x < left + advances[i] * 0.5f) return i;
+                left += advances[i];
+            }
+            return (int)str.size();
+        }
+        else {
+            // Binary search over measured prefixes
+            string utf8;
+            int lo = 0, hi = (int)str.size();
+            while (lo < hi) {
+                int mid = (lo + hi + 1) / 2;
+                if (measureWidth(f, str.substr(0, mid), utf8) <= x) lo = mid;
+                else hi = mid - 1;
+            }
+            return lo;
+        }
+    }
+
+    // stringWidthしか持たないフォント用（従来の方法）
+    void setCursorByMouseMeasured(FontType &f, float x, float y) {
         auto bbox = f.getStringBoundingBox(getString(), lastDrawPos.x, lastDrawPos.y);
 
         // Check if click is inside bbox
@@ -333,7 +1022,7 @@ public:
         // Find clicked character
         auto lineBbox = f.getStringBoundingBox(UTF32toUTF8(line[lineNumber]), lastDrawPos.x, lastDrawPos.y + f.getLineHeight() * lineNumber);
         int posNumber = ofMap(x, 0, lineBbox.width, 0, line[lineNumber].size());
-        posNumber = MIN(posNumber, (int)line[cursorLine].size());
+        posNumber = MIN(posNumber, (int)line[lineNumber].size());
 
         // Update cursor position
         cursorLine = lineNumber;
@@ -341,27 +1030,15 @@ public:
         cursorBlinkOffsetTime = ofGetElapsedTimef();
     }
 
-    // 描画位置のスクリーン座標を返す（IME候補ウィンドウ表示用）
-    ofVec2f getMarkedTextScreenPosition() override {
-        FontType& f = getFont();
-        float x = lastDrawPos.x;
-        float y = lastDrawPos.y;
-
-        // Calculate Y coordinate for current line
-        y += f.getLineHeight() * cursorLine;
-
-        // Calculate X coordinate for cursor position
-        string beforeCursor = getLineSubstr(cursorLine, 0, cursorPos);
-        x += f.stringWidth(beforeCursor);
-
-        return ofVec2f(x, y);
-    }
-
-private:
     // 描画用のフォント
     FontType font;
     FontType* fontPtr = nullptr;  // 共有フォント使用時のポインタ
-    FontType& getFont() { return fontPtr ? *fontPtr : font; }
+    std::shared_ptr<typename ofxIMEFontRegistry<FontType>::Entry> registryFont;  // レジストリのフォント
+    FontType& getFont() {
+        if (fontPtr) return *fontPtr;
+        if (registryFont) return registryFont->get();
+        return font;
+    }
 
     // マウスイベントのハンドラ
     void mousePressed(ofMouseEventArgs &mouse) {
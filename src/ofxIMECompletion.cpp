@@ -0,0 +1,332 @@
+#include "ofxIMECompletion.h"
+
+#include <cstdio>
+#include <functional>
+
+namespace {
+    const char completionMagic[4] = {'I', 'M', 'E', 'C'};
+    const uint32_t completionVersion = 1;
+    const uint32_t notFound = ~0u;
+
+    uint32_t addSaturated(uint32_t a, uint32_t b) {
+        return a > UINT32_MAX - b ? UINT32_MAX : a + b;
+    }
+}
+
+ofxIMECompletion::~ofxIMECompletion() {
+    close();
+}
+
+bool ofxIMECompletion::isWordChar(char32_t c) {
+    switch (c) {
+    case U' ': case U'\t': case U'\n': case U'\r': case U'　':
+    case U'.': case U',': case U';': case U':': case U'!': case U'?':
+    case U'(': case U')': case U'[': case U']': case U'{': case U'}':
+    case U'<': case U'>': case U'"': case U'\'': case U'`':
+    case U'、': case U'。': case U'，': case U'．': case U'・':
+    case U'「': case U'」': case U'『': case U'』': case U'（': case U'）':
+    case U'！': case U'？':
+        return false;
+    default:
+        return true;
+    }
+}
+
+bool ofxIMECompletion::open(const string &filename) {
+    close();
+    path = filename;
+
+    // A missing file is an empty dictionary; save() creates it
+    if (!ofFile::doesFileExist(path, false)) return true;
+    if (!mapFile()) {
+        ofLogError("ofxIMECompletion") << "invalid dictionary: " << path;
+        return false;
+    }
+    return true;
+}
+
+void ofxIMECompletion::close() {
+    unmapFile();
+    pending.clear();
+    path.clear();
+    revision++;
+}
+
+bool ofxIMECompletion::mapFile() {
+    if (!file.open(path)) return false;
+
+    // The arrays are used in place; one pass checks that every index stays
+    // inside the file and that edges only point forward (so walks terminate)
+    const char *base = file.getData();
+    size_t mappingSize = file.size();
+    const Header *h = (const Header *)base;
+    bool ok = mappingSize >= sizeof(Header) && memcmp(h->magic, completionMagic, 4) == 0 &&
+              h->version == completionVersion && h->numNodes > 0 &&
+              mappingSize == sizeof(Header) + (uint64_t)h->numNodes * sizeof(Node) + (uint64_t)h->numEdges * sizeof(Edge);
+    if (ok) {
+        const Node *n = (const Node *)(base + sizeof(Header));
+        const Edge *e = (const Edge *)(n + h->numNodes);
+        for (uint32_t i = 0; i < h->numNodes && ok; ++i) {
+            ok = (uint64_t)n[i].firstEdge + n[i].numEdges <= h->numEdges;
+            for (uint32_t k = 0; k < n[i].numEdges && ok; ++k) {
+                uint32_t t = e[n[i].firstEdge + k].target;
+                ok = t > i && t < h->numNodes;
+            }
+        }
+        if (ok) {
+            header = h;
+            nodes = n;
+            edges = e;
+        }
+    }
+    if (!ok) unmapFile();
+    return ok;
+}
+
+void ofxIMECompletion::unmapFile() {
+    header = nullptr;
+    nodes = nullptr;
+    edges = nullptr;
+    file.close();
+}
+
+void ofxIMECompletion::learn(std::u32string_view phrase, uint32_t weight) {
+    if (phrase.empty() || (int)phrase.length() > maxPhraseLength) return;
+    if (phrase.find(U'\n') != std::u32string_view::npos) return;
+
+    auto it = pending.find(phrase);
+    if (it == pending.end()) {
+        it = pending.emplace(u32string(phrase), 0).first;
+    }
+    it->second = addSaturated(it->second, weight);
+    revision++;
+}
+
+void ofxIMECompletion::learnFromInsert(std::u32string_view text, std::u32string_view lineText, int pos) {
+    if (text.empty()) return;
+
+    if (text.length() == 1 && !isWordChar(text[0])) {
+        // A delimiter ends the alphanumeric word typed before it
+        int end = MIN(pos, (int)lineText.length());
+        int begin = end;
+        while (begin > 0 && lineText[begin - 1] < 0x80 && isWordChar(lineText[begin - 1])) {
+            begin--;
+        }
+        if (end - begin >= 2) learn(lineText.substr(begin, end - begin));
+        return;
+    }
+
+    // A conversion committed by the IME arrives as one insert
+    bool ascii = true;
+    for (char32_t c : text) {
+        if (!isWordChar(c)) return;
+        if (c >= 0x80) ascii = false;
+    }
+    if (text.length() >= 2 && !ascii) learn(text);
+}
+
+uint32_t ofxIMECompletion::find(std::u32string_view prefix) const {
+    if (!nodes) return notFound;
+    uint32_t node = 0;
+    for (char32_t c : prefix) {
+        // Edges of a node are sorted by label
+        const Edge *first = edges + nodes[node].firstEdge;
+        const Edge *last = first + nodes[node].numEdges;
+        const Edge *e = std::lower_bound(first, last, c, [](const Edge &a, char32_t b) { return a.label < b; });
+        if (e == last || e->label != c) return notFound;
+        node = e->target;
+    }
+    return node;
+}
+
+uint32_t ofxIMECompletion::mappedWeight(std::u32string_view phrase) const {
+    uint32_t node = find(phrase);
+    return node == notFound ? 0 : nodes[node].weight;
+}
+
+uint32_t ofxIMECompletion::getWeight(std::u32string_view phrase) const {
+    uint32_t w = mappedWeight(phrase);
+    auto it = pending.find(phrase);
+    return it == pending.end() ? w : addSaturated(w, it->second);
+}
+
+size_t ofxIMECompletion::getNumPhrases() const {
+    size_t n = header ? header->numPhrases : 0;
+    for (auto &kv : pending) {
+        if (mappedWeight(kv.first) == 0) n++;
+    }
+    return n;
+}
+
+void ofxIMECompletion::offer(std::u32string_view phrase, uint32_t weight, size_t maxResults) const {
+    auto &out = *results;
+    size_t n = resultWeights.size();
+    if (n == maxResults && weight <= resultWeights.back()) return;
+
+    // Insertion into the sorted top-k; the strings are swapped, not copied,
+    // so their buffers are reused from one lookup to the next
+    size_t i = n;
+    if (n < maxResults) {
+        resultWeights.push_back(weight);
+        if (out.size() <= n) out.emplace_back();
+    }
+    else {
+        i = n - 1;
+    }
+    while (i > 0 && resultWeights[i - 1] < weight) {
+        resultWeights[i] = resultWeights[i - 1];
+        std::swap(out[i], out[i - 1]);
+        i--;
+    }
+    resultWeights[i] = weight;
+    out[i].assign(phrase.data(), phrase.length());
+}
+
+void ofxIMECompletion::collect(uint32_t node, int depth, size_t maxResults) const {
+    const Node &n = nodes[node];
+    if (resultWeights.size() == maxResults && n.maxWeight <= resultWeights.back()) return;
+
+    if (n.weight > 0 && (size_t)depth > prefixLength) {
+        uint32_t w = n.weight;
+        auto it = pending.find(std::u32string_view(walk.data(), depth));
+        if (it != pending.end()) w = addSaturated(w, it->second);
+        offer(std::u32string_view(walk.data(), depth), w, maxResults);
+    }
+
+    if (walk.size() <= (size_t)depth) walk.resize(depth + 1);
+    for (uint32_t k = 0; k < n.numEdges; ++k) {
+        const Edge &e = edges[n.firstEdge + k];
+        walk[depth] = e.label;
+        collect(e.target, depth + 1, maxResults);
+    }
+}
+
+void ofxIMECompletion::lookup(std::u32string_view prefix, int maxResults, vector<u32string> &out) const {
+    resultWeights.clear();
+    results = &out;
+    if (maxResults <= 0 || prefix.empty()) {
+        out.clear();
+        return;
+    }
+
+    // Phrases from the file, best first, pruned by each subtree's best weight
+    prefixLength = prefix.length();
+    uint32_t node = find(prefix);
+    if (node != notFound) {
+        walk.assign(prefix.begin(), prefix.end());
+        collect(node, (int)prefixLength, maxResults);
+    }
+
+    // Phrases learned since the last save. Ones also in the file were ranked
+    // with their total above unless pruning skipped their subtree
+    for (auto it = pending.lower_bound(prefix); it != pending.end(); ++it) {
+        std::u32string_view phrase = it->first;
+        if (phrase.substr(0, prefix.length()) != prefix) break;
+        if (phrase.length() == prefix.length()) continue;
+        bool ranked = false;
+        for (size_t i = 0; i < resultWeights.size() && !ranked; ++i) {
+            ranked = out[i] == phrase;
+        }
+        if (!ranked) offer(phrase, addSaturated(mappedWeight(phrase), it->second), maxResults);
+    }
+
+    out.resize(resultWeights.size());
+    results = nullptr;
+}
+
+void ofxIMECompletion::enumerate(uint32_t node, int depth, std::map<u32string, uint32_t, std::less<>> &dst) const {
+    const Node &n = nodes[node];
+    if (n.weight > 0) dst.emplace(u32string(walk.data(), depth), n.weight);
+    if (walk.size() <= (size_t)depth) walk.resize(depth + 1);
+    for (uint32_t k = 0; k < n.numEdges; ++k) {
+        const Edge &e = edges[n.firstEdge + k];
+        walk[depth] = e.label;
+        enumerate(e.target, depth + 1, dst);
+    }
+}
+
+bool ofxIMECompletion::save() {
+    if (path.empty()) return false;
+    if (pending.empty()) return true;
+
+    // Merge the file with what was learned since
+    std::map<u32string, uint32_t, std::less<>> all;
+    if (nodes) {
+        walk.clear();
+        enumerate(0, 0, all);
+    }
+    for (auto &kv : pending) {
+        uint32_t &w = all[kv.first];
+        w = addSaturated(w, kv.second);
+    }
+
+    // Build the trie in preorder: each node's edges are contiguous and
+    // sorted, and children always come after their parent
+    vector<std::pair<u32string, uint32_t>> items(all.begin(), all.end());
+    vector<Node> newNodes;
+    vector<Edge> newEdges;
+    std::function<uint32_t(size_t, size_t, size_t)> build = [&](size_t lo, size_t hi, size_t depth) {
+        uint32_t index = newNodes.size();
+        newNodes.push_back({});
+        uint32_t weight = 0;
+        if (lo < hi && items[lo].first.length() == depth) {
+            weight = items[lo].second;
+            lo++;
+        }
+
+        uint32_t numEdges = 0;
+        for (size_t i = lo; i < hi; ++i) {
+            if (i == lo || items[i].first[depth] != items[i - 1].first[depth]) numEdges++;
+        }
+        uint32_t firstEdge = newEdges.size();
+        newEdges.resize(firstEdge + numEdges);
+
+        uint32_t maxWeight = weight;
+        uint32_t k = 0;
+        for (size_t i = lo; i < hi;) {
+            size_t j = i + 1;
+            while (j < hi && items[j].first[depth] == items[i].first[depth]) j++;
+            uint32_t child = build(i, j, depth + 1);
+            newEdges[firstEdge + k++] = {items[i].first[depth], child};
+            maxWeight = MAX(maxWeight, newNodes[child].maxWeight);
+            i = j;
+        }
+        newNodes[index] = {firstEdge, numEdges, weight, maxWeight};
+        return index;
+    };
+    build(0, items.size(), 0);
+
+    Header h;
+    memcpy(h.magic, completionMagic, 4);
+    h.version = completionVersion;
+    h.numNodes = newNodes.size();
+    h.numEdges = newEdges.size();
+    h.numPhrases = items.size();
+
+    // Write next to the file and swap it in (the old mapping is released
+    // first; Windows cannot replace a mapped file)
+    unmapFile();
+    string tmp = path + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "wb");
+    bool ok = f != nullptr;
+    if (f) {
+        ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+             fwrite(newNodes.data(), sizeof(Node), newNodes.size(), f) == newNodes.size() &&
+             fwrite(newEdges.data(), sizeof(Edge), newEdges.size(), f) == newEdges.size();
+        ok = fclose(f) == 0 && ok;
+    }
+#ifdef WIN32
+    ok = ok && MoveFileExA(tmp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    ok = ok && rename(tmp.c_str(), path.c_str()) == 0;
+#endif
+    if (!ok) {
+        ofLogError("ofxIMECompletion") << "failed to save " << path;
+        mapFile();
+        return false;
+    }
+
+    pending.clear();
+    revision++;
+    return mapFile();
+}
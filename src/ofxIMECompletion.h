@@ -0,0 +1,103 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ofxIMEMappedFile.h"
+
+#include <map>
+#include <string_view>
+
+// 入力補完（予測変換）の辞書
+// 確定した語句を学習し、接頭辞から頻度の高い順に候補を返す。
+// 辞書ファイルはトライをそのまま配列にしたもので、open()ではメモリマップするだけ
+// （読み込み時のパースはない）。新しく学習した語はメモリ上に溜めておき、
+// save()でファイルの内容とマージしてトライを作り直す。
+//
+//   completion.open(ofToDataPath("user.dic"));
+//   ime.setCompletion(&completion);
+//   ...
+//   completion.save();   // exit()などで
+class ofxIMECompletion {
+public:
+    ofxIMECompletion() = default;
+    ~ofxIMECompletion();
+
+    ofxIMECompletion(const ofxIMECompletion &) = delete;
+    ofxIMECompletion &operator=(const ofxIMECompletion &) = delete;
+
+    // 辞書ファイルを開く（なければ空で始め、save()で作る）
+    bool open(const string &path);
+    bool save();
+    void close();
+
+    // 語句を学習する（重みは出現回数）
+    void learn(std::u32string_view phrase, uint32_t weight = 1);
+
+    // ユーザーが確定した文字列の挿入から学習する（ofxIMEBaseが呼ぶ。貼り付けや追記は含まない）
+    //   IMEの確定のように区切りを含まない複数文字 → その語句
+    //   区切り文字（空白や句読点） → 直前に打った英数字の語（品番など）
+    // lineTextは挿入後の行、posは挿入した位置
+    void learnFromInsert(std::u32string_view text, std::u32string_view lineText, int pos);
+
+    // prefixで始まる語句を重みの大きい順に最大maxResults個返す（prefix自身は除く）
+    // outの文字列は使い回すので、結果が変わらなければ確保しない
+    void lookup(std::u32string_view prefix, int maxResults, vector<u32string> &out) const;
+    uint32_t getWeight(std::u32string_view phrase) const;
+
+    // 学習できる語句の最大長（文字数）
+    void setMaxPhraseLength(int length) { maxPhraseLength = length; }
+
+    size_t getNumPhrases() const;
+    size_t getNumPending() const { return pending.size(); }
+
+    // 学習・保存のたびに増える（表示側の再検索の判定用）
+    uint64_t getRevision() const { return revision; }
+
+    // 語を構成する文字（区切り以外）
+    static bool isWordChar(char32_t c);
+
+private:
+    // ファイル上の配列（ホストのバイト順、すべて4バイト単位）
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t numNodes;
+        uint32_t numEdges;
+        uint32_t numPhrases;
+    };
+    struct Node {
+        uint32_t firstEdge;     // 子への辺（文字順）の先頭
+        uint32_t numEdges;
+        uint32_t weight;        // 0 = ここで終わる語はない
+        uint32_t maxWeight;     // 部分木の中の最大の重み（枝刈り用）
+    };
+    struct Edge {
+        char32_t label;
+        uint32_t target;
+    };
+
+    bool mapFile();
+    void unmapFile();
+    uint32_t find(std::u32string_view prefix) const;    // ノード番号、なければ~0
+    uint32_t mappedWeight(std::u32string_view phrase) const;
+    void collect(uint32_t node, int depth, size_t maxResults) const;
+    void enumerate(uint32_t node, int depth, std::map<u32string, uint32_t, std::less<>> &dst) const;
+    void offer(std::u32string_view phrase, uint32_t weight, size_t maxResults) const;
+
+    string path;
+    const Header *header = nullptr;
+    const Node *nodes = nullptr;
+    const Edge *edges = nullptr;
+    ofxIMEMappedFile file;
+
+    // 未保存の学習結果（ファイルの重みに加算される）
+    std::map<u32string, uint32_t, std::less<>> pending;
+
+    int maxPhraseLength = 32;
+    uint64_t revision = 0;
+
+    // lookup()の作業領域
+    mutable vector<char32_t> walk;     // たどっている途中の語句
+    mutable size_t prefixLength = 0;
+    mutable vector<u32string> *results = nullptr;
+    mutable vector<uint32_t> resultWeights;
+};
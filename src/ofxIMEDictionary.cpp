@@ -0,0 +1,275 @@
+#include "ofxIMEDictionary.h"
+#include "ofxIME.h"
+
+#include <cstdio>
+
+namespace {
+    const char indexMagic[4] = {'I', 'M', 'E', 'D'};
+    const uint32_t indexVersion = 1;
+
+    // Longest reading tried when splitting into segments
+    const int maxSegmentLength = 16;
+
+    int64_t modifiedTime(const string &path) {
+        std::error_code ec;
+        auto t = of::filesystem::last_write_time(path, ec);
+        return ec ? 0 : (int64_t)t.time_since_epoch().count();
+    }
+}
+
+bool ofxIMEDictionary::open(const string &path) {
+    close();
+    if (!dict.open(path)) {
+        ofLogError("ofxIMEDictionary") << "cannot open " << path;
+        return false;
+    }
+
+    string indexPath = path + ".idx";
+    int64_t modified = modifiedTime(path);
+    if (!openIndex(indexPath, modified)) {
+        buildIndex(indexPath, modified);
+    }
+    return true;
+}
+
+void ofxIMEDictionary::close() {
+    offsets = nullptr;
+    numEntries = 0;
+    builtIndex.clear();
+    indexFile.close();
+    dict.close();
+}
+
+bool ofxIMEDictionary::openIndex(const string &indexPath, int64_t modified) {
+    if (!indexFile.open(indexPath)) return false;
+
+    // Only trust an index made from this exact dictionary file
+    IndexHeader h;
+    bool ok = indexFile.size() >= sizeof(h);
+    if (ok) {
+        memcpy(&h, indexFile.getData(), sizeof(h));
+        ok = memcmp(h.magic, indexMagic, 4) == 0 && h.version == indexVersion &&
+             h.dictSize == dict.size() && h.dictModified == modified &&
+             indexFile.size() == sizeof(h) + (uint64_t)h.numEntries * sizeof(uint32_t);
+    }
+    if (ok) {
+        const uint32_t *o = (const uint32_t *)(indexFile.getData() + sizeof(h));
+        for (uint32_t i = 0; i < h.numEntries && ok; ++i) {
+            ok = o[i] < dict.size();
+        }
+        if (ok) {
+            offsets = o;
+            numEntries = h.numEntries;
+        }
+    }
+    if (!ok) indexFile.close();
+    return ok;
+}
+
+void ofxIMEDictionary::buildIndex(const string &indexPath, int64_t modified) {
+    // One entry per "reading /candidates/" line; comments start with ';'
+    const char *data = dict.getData();
+    const char *end = data + dict.size();
+    builtIndex.clear();
+    for (const char *p = data; p < end;) {
+        const char *eol = (const char *)memchr(p, '\n', end - p);
+        if (!eol) eol = end;
+        if (p < eol && *p != ';') {
+            const char *space = (const char *)memchr(p, ' ', eol - p);
+            if (space && space > p && space + 1 < eol && space[1] == '/') {
+                builtIndex.push_back((uint32_t)(p - data));
+            }
+        }
+        p = eol + 1;
+    }
+
+    // Byte order of UTF-8 is code point order, so readings compare as bytes
+    std::sort(builtIndex.begin(), builtIndex.end(), [this](uint32_t a, uint32_t b) {
+        return readingAt(a) < readingAt(b);
+    });
+    offsets = builtIndex.data();
+    numEntries = builtIndex.size();
+
+    IndexHeader h = {};
+    memcpy(h.magic, indexMagic, 4);
+    h.version = indexVersion;
+    h.dictSize = dict.size();
+    h.dictModified = modified;
+    h.numEntries = numEntries;
+
+    string tmp = indexPath + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "wb");
+    bool ok = f != nullptr;
+    if (f) {
+        ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+             fwrite(builtIndex.data(), sizeof(uint32_t), builtIndex.size(), f) == builtIndex.size();
+        ok = fclose(f) == 0 && ok;
+    }
+#ifdef WIN32
+    ok = ok && MoveFileExA(tmp.c_str(), indexPath.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    ok = ok && rename(tmp.c_str(), indexPath.c_str()) == 0;
+#endif
+    if (!ok) {
+        // Still usable; the index is just built again next time
+        ofLogNotice("ofxIMEDictionary") << "cannot write " << indexPath << ", keeping the index in memory";
+    }
+}
+
+std::string_view ofxIMEDictionary::readingAt(uint32_t offset) const {
+    const char *p = dict.getData() + offset;
+    const char *end = dict.getData() + dict.size();
+    const char *space = (const char *)memchr(p, ' ', end - p);
+    return std::string_view(p, (space ? space : end) - p);
+}
+
+int64_t ofxIMEDictionary::find(std::u32string_view reading) const {
+    if (!offsets || reading.empty()) return -1;
+    ofxIMEBase::UTF32toUTF8(reading, key);
+
+    const uint32_t *last = offsets + numEntries;
+    const uint32_t *it = std::lower_bound(offsets, last, key, [this](uint32_t o, const string &k) {
+        return readingAt(o) < std::string_view(k);
+    });
+    if (it == last || readingAt(*it) != std::string_view(key)) return -1;
+    return it - offsets;
+}
+
+bool ofxIMEDictionary::contains(std::u32string_view reading) const {
+    return find(reading) >= 0;
+}
+
+bool ofxIMEDictionary::lookup(std::u32string_view reading, vector<u32string> &out) const {
+    int64_t index = find(reading);
+    if (index < 0) {
+        out.clear();
+        return false;
+    }
+
+    // A merged dictionary may list the same reading on several lines
+    size_t n = 0;
+    const char *end = dict.getData() + dict.size();
+    for (size_t i = index; i < numEntries && readingAt(offsets[i]) == std::string_view(key); ++i) {
+        const char *p = dict.getData() + offsets[i] + key.size() + 1;
+        const char *eol = (const char *)memchr(p, '\n', end - p);
+        if (!eol) eol = end;
+
+        // /candidate;annotation/candidate/...
+        while (p < eol) {
+            const char *slash = (const char *)memchr(p, '/', eol - p);
+            if (!slash) break;
+            const char *next = (const char *)memchr(slash + 1, '/', eol - slash - 1);
+            if (!next) break;
+            std::string_view cand(slash + 1, next - slash - 1);
+            cand = cand.substr(0, cand.find(';'));
+            p = next;
+            if (cand.empty() || cand[0] == '(') continue;
+
+            if (out.size() <= n) out.emplace_back();
+            ofxIMEBase::UTF8toUTF32(cand, out[n]);
+            if (std::find(out.begin(), out.begin() + n, out[n]) == out.begin() + n) n++;
+        }
+    }
+    out.resize(n);
+    return n > 0;
+}
+
+void ofxIMEConversion::start(const ofxIMEDictionary &dict, std::u32string_view str) {
+    dictionary = &dict;
+    reading.assign(str.data(), str.length());
+    focus = 0;
+    segmentFrom(0, 0);
+}
+
+void ofxIMEConversion::cancel() {
+    segments.clear();
+    focus = 0;
+}
+
+void ofxIMEConversion::segmentFrom(size_t index, int begin) {
+    // Greedy longest match: each segment takes the longest reading that the
+    // dictionary knows, or a single character if none
+    segments.resize(index);
+    std::u32string_view r = reading;
+    for (int pos = begin; pos < (int)r.length();) {
+        int length = MIN(maxSegmentLength, (int)r.length() - pos);
+        while (length > 1 && !dictionary->contains(r.substr(pos, length))) {
+            length--;
+        }
+        segments.emplace_back();
+        Segment &s = segments.back();
+        s.begin = pos;
+        s.length = length;
+        fill(s);
+        pos += length;
+    }
+}
+
+void ofxIMEConversion::fill(Segment &s) {
+    std::u32string_view r = std::u32string_view(reading).substr(s.begin, s.length);
+    dictionary->lookup(r, s.candidates);
+    s.selected = 0;
+
+    // The kana themselves are always offered after the dictionary's candidates
+    u32string hiragana(r);
+    u32string katakana = hiragana;
+    ofxIMERomajiComposer::toKatakana(katakana);
+    for (auto *k : {&hiragana, &katakana}) {
+        if (std::find(s.candidates.begin(), s.candidates.end(), *k) == s.candidates.end()) {
+            s.candidates.push_back(*k);
+        }
+    }
+}
+
+void ofxIMEConversion::nextCandidate() {
+    if (segments.empty()) return;
+    Segment &s = segments[focus];
+    s.selected = (s.selected + 1) % s.candidates.size();
+}
+
+void ofxIMEConversion::prevCandidate() {
+    if (segments.empty()) return;
+    Segment &s = segments[focus];
+    s.selected = (s.selected + s.candidates.size() - 1) % s.candidates.size();
+}
+
+void ofxIMEConversion::focusNext() {
+    focus = MIN(focus + 1, (int)segments.size() - 1);
+}
+
+void ofxIMEConversion::focusPrev() {
+    focus = MAX(focus - 1, 0);
+}
+
+void ofxIMEConversion::resizeSegment(int delta) {
+    if (segments.empty()) return;
+    Segment &s = segments[focus];
+    int length = s.length + delta;
+    if (length < 1 || s.begin + length > (int)reading.length()) return;
+
+    s.length = length;
+    fill(s);
+    segmentFrom(focus + 1, s.begin + length);
+}
+
+void ofxIMEConversion::compose(u32string &marked, int &focusLocation, int &focusLength) const {
+    marked.clear();
+    focusLocation = focusLength = 0;
+    for (int i = 0; i < (int)segments.size(); ++i) {
+        const u32string &c = segments[i].candidates[segments[i].selected];
+        if (i == focus) {
+            focusLocation = marked.length();
+            focusLength = c.length();
+        }
+        marked += c;
+    }
+}
+
+const vector<u32string> &ofxIMEConversion::getCandidates() const {
+    static const vector<u32string> empty;
+    return segments.empty() ? empty : segments[focus].candidates;
+}
+
+int ofxIMEConversion::getCandidateIndex() const {
+    return segments.empty() ? 0 : segments[focus].selected;
+}
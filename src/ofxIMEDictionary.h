@@ -0,0 +1,96 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ofxIMEMappedFile.h"
+
+#include <string_view>
+
+// かな漢字変換の辞書（SKK形式、UTF-8）
+//   よみ /候補1/候補2;注釈/.../
+// 辞書ファイルはメモリマップして読み込まない。読みの順に並べた行の位置（索引）を
+// 初回に作って「辞書ファイル名.idx」に保存し、次回からはそれもマップするだけにする
+// （辞書のサイズか更新時刻が変われば作り直す）。検索は索引の二分探索。
+// EUC-JPの辞書（SKK-JISYO.Lなど）は先にUTF-8に変換しておく
+class ofxIMEDictionary {
+public:
+    ofxIMEDictionary() = default;
+
+    ofxIMEDictionary(const ofxIMEDictionary &) = delete;
+    ofxIMEDictionary &operator=(const ofxIMEDictionary &) = delete;
+
+    bool open(const string &path);
+    void close();
+    bool isOpen() const { return dict.isOpen(); }
+
+    // readingの候補をoutに入れる（注釈と(concat ...)などの式は除く）。見つかればtrue
+    bool lookup(std::u32string_view reading, vector<u32string> &out) const;
+    bool contains(std::u32string_view reading) const;
+
+    size_t getNumEntries() const { return numEntries; }
+
+private:
+    struct IndexHeader {
+        char magic[4];
+        uint32_t version;
+        uint64_t dictSize;
+        int64_t dictModified;
+        uint32_t numEntries;
+        uint32_t reserved;
+    };
+
+    bool openIndex(const string &indexPath, int64_t modified);
+    void buildIndex(const string &indexPath, int64_t modified);
+    int64_t find(std::u32string_view reading) const;   // 索引の位置、なければ-1
+    std::string_view readingAt(uint32_t offset) const;
+
+    ofxIMEMappedFile dict;
+    ofxIMEMappedFile indexFile;
+    vector<uint32_t> builtIndex;        // .idxを書けなかったときはメモリ上に持つ
+    const uint32_t *offsets = nullptr;  // 各行の先頭位置（読みの順）
+    size_t numEntries = 0;
+
+    mutable string key;                 // 検索用の作業領域（UTF-8の読み）
+};
+
+// 文節に分けて変換する（組み込みの変換器用）
+// 読みを前から最長一致で文節に区切り、文節ごとに候補を持つ
+class ofxIMEConversion {
+public:
+    void start(const ofxIMEDictionary &dictionary, std::u32string_view reading);
+    void cancel();
+    bool isActive() const { return !segments.empty(); }
+
+    // 注目している文節の候補を選ぶ
+    void nextCandidate();
+    void prevCandidate();
+
+    // 注目する文節を移す
+    void focusNext();
+    void focusPrev();
+
+    // 注目している文節の読みを1文字伸ばす・縮める（後ろの文節は区切り直す）
+    void resizeSegment(int delta);
+
+    // 表示する文字列と、その中の注目文節の位置
+    void compose(u32string &marked, int &focusLocation, int &focusLength) const;
+
+    const u32string &getReading() const { return reading; }
+    const vector<u32string> &getCandidates() const;
+    int getCandidateIndex() const;
+
+private:
+    struct Segment {
+        int begin = 0;          // 読みの中の位置
+        int length = 0;
+        int selected = 0;
+        vector<u32string> candidates;   // 辞書の候補、ひらがな、カタカナ
+    };
+
+    void segmentFrom(size_t index, int begin);
+    void fill(Segment &s);
+
+    const ofxIMEDictionary *dictionary = nullptr;
+    u32string reading;
+    vector<Segment> segments;
+    int focus = 0;
+};
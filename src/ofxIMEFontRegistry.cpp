@@ -0,0 +1,61 @@
+#include "ofxIMEFontRegistry.h"
+
+ofxIMEFontLoader &ofxIMEFontLoader::get() {
+    static ofxIMEFontLoader loader;
+    return loader;
+}
+
+ofxIMEFontLoader::ofxIMEFontLoader() {
+    worker = std::thread(&ofxIMEFontLoader::workerLoop, this);
+    ofAddListener(ofEvents().update, this, &ofxIMEFontLoader::update);
+}
+
+ofxIMEFontLoader::~ofxIMEFontLoader() {
+    ofRemoveListener(ofEvents().update, this, &ofxIMEFontLoader::update);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        backgroundJobs.clear();
+    }
+    cv.notify_all();
+    if (worker.joinable()) worker.join();
+}
+
+void ofxIMEFontLoader::runInBackground(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        backgroundJobs.push_back(std::move(job));
+    }
+    cv.notify_one();
+}
+
+void ofxIMEFontLoader::runOnMainThread(std::function<void()> job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    mainThreadJobs.push_back(std::move(job));
+}
+
+void ofxIMEFontLoader::workerLoop() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return stopping || !backgroundJobs.empty(); });
+            if (stopping) return;
+            job = std::move(backgroundJobs.front());
+            backgroundJobs.pop_front();
+        }
+        job();
+    }
+}
+
+void ofxIMEFontLoader::update(ofEventArgs &) {
+    // One synchronous load per frame so several fonts do not stall one frame
+    std::function<void()> job;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (mainThreadJobs.empty()) return;
+        job = std::move(mainThreadJobs.front());
+        mainThreadJobs.pop_front();
+    }
+    job();
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ofxIMEFontTraits.h"
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+// フォント読み込みのジョブキュー（全FontType共通）
+// ワーカースレッド1本と、GLスレッドで1フレームに1件ずつ処理するキューを持つ
+class ofxIMEFontLoader {
+public:
+    static ofxIMEFontLoader &get();
+
+    void runInBackground(std::function<void()> job);
+    void runOnMainThread(std::function<void()> job);
+
+    ~ofxIMEFontLoader();
+
+private:
+    ofxIMEFontLoader();
+    void workerLoop();
+    void update(ofEventArgs &args);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> backgroundJobs;
+    std::deque<std::function<void()>> mainThreadJobs;
+    bool stopping = false;
+    std::thread worker;
+};
+
+// プロセス全体で共有するフォント
+// (パス, サイズ, 文字範囲) が同じなら同じフォントを返し、最後の利用者が
+// 手放したら解放する。読み込みはsetup()を止めずに行う:
+//   FontTypeがprepare()を持つ（ofxIMELazyFontなど） → ワーカースレッド
+//   持たない（ofTrueTypeFontはload時にテクスチャを作るため） → 次のupdateでGLスレッド
+template<typename FontType>
+class ofxIMEFontRegistry {
+public:
+    class Entry {
+    public:
+        FontType &get() { return font; }
+        bool isReady() const { return ready.load(std::memory_order_acquire); }
+        bool isFailed() const { return failed.load(std::memory_order_acquire); }
+
+    private:
+        friend class ofxIMEFontRegistry;
+        FontType font;
+        std::atomic<bool> ready{false};
+        std::atomic<bool> failed{false};
+    };
+
+    static std::shared_ptr<Entry> acquire(const ofTrueTypeFontSettings &settings) {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+
+        string key = makeKey(settings);
+        auto it = r.entries.find(key);
+        if (it != r.entries.end()) {
+            if (auto entry = it->second.lock()) return entry;
+        }
+
+        // Drop entries nobody holds any more
+        for (auto e = r.entries.begin(); e != r.entries.end();) {
+            if (e->second.expired()) e = r.entries.erase(e);
+            else ++e;
+        }
+
+        auto entry = std::make_shared<Entry>();
+        r.entries[key] = entry;
+
+        // The job keeps the entry alive until it has finished loading
+        auto job = [entry, settings]() {
+            bool ok;
+            if constexpr (ofxIMEFontTraits<FontType>::asyncLoad) {
+                ok = entry->font.prepare(settings);
+            }
+            else {
+                ok = entry->font.load(settings);
+            }
+            if (!ok) entry->failed.store(true, std::memory_order_release);
+            entry->ready.store(ok, std::memory_order_release);
+        };
+        if constexpr (ofxIMEFontTraits<FontType>::asyncLoad) {
+            ofxIMEFontLoader::get().runInBackground(job);
+        }
+        else {
+            ofxIMEFontLoader::get().runOnMainThread(job);
+        }
+        return entry;
+    }
+
+    // 使用中のフォント数
+    static size_t getNumFonts() {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        size_t n = 0;
+        for (auto &e : r.entries) {
+            if (!e.second.expired()) n++;
+        }
+        return n;
+    }
+
+private:
+    struct Registry {
+        std::mutex mutex;
+        std::map<string, std::weak_ptr<Entry>> entries;
+    };
+
+    static Registry &registry() {
+        static Registry r;
+        return r;
+    }
+
+    static string makeKey(const ofTrueTypeFontSettings &settings) {
+        std::ostringstream key;
+        key << settings.fontName.string() << '|' << settings.fontSize << '|' << settings.dpi;
+        for (auto &range : settings.ranges) {
+            key << '|' << range.begin << '-' << range.end;
+        }
+        return key.str();
+    }
+};
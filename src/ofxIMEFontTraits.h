@@ -0,0 +1,100 @@
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// FontTypeが何をサポートしているかをコンパイル時に判定する
+// ofxIME<FontType>はこれを見てレイアウトの計算方法を選ぶ
+//
+// 固定ピッチ:  static constexpr bool fixedPitch = true; と float getCellWidth() const
+//              （全角文字は2セルとして扱う）
+// 一括advance: void getAdvances(std::u32string_view str, float *out) const
+//              （strの各文字の送り幅をoutに書く）
+// どちらもなければofTrueTypeFont互換のstringWidth()で測る。
+// 非同期読み込み: bool prepare(const ofTrueTypeFontSettings &)
+//              （GLを使わず任意のスレッドから呼べる。ofxIMEFontRegistryが使う）
+// 描画先:      Target *getTarget() const
+//              （ofxIMESoftwareCanvasのようなもの。あればdraw()はGLを使わずにそこへ描く）
+// 既存のフォントクラスを変更できない場合はofxIMEFontTraitsを特殊化してもよい
+
+namespace ofxIMEDetail {
+    template<typename F, typename = void>
+    struct HasFixedPitch : std::false_type {};
+
+    template<typename F>
+    struct HasFixedPitch<F, std::void_t<decltype(F::fixedPitch),
+                                        decltype(std::declval<const F &>().getCellWidth())>>
+        : std::bool_constant<F::fixedPitch> {};
+
+    template<typename F, typename = void>
+    struct HasAdvances : std::false_type {};
+
+    template<typename F>
+    struct HasAdvances<F, std::void_t<decltype(std::declval<const F &>().getAdvances(
+                              std::declval<std::u32string_view>(), std::declval<float *>()))>>
+        : std::true_type {};
+
+    template<typename F, typename = void>
+    struct HasPrepare : std::false_type {};
+
+    template<typename F>
+    struct HasPrepare<F, std::void_t<decltype(&F::prepare)>> : std::true_type {};
+
+    template<typename F, typename = void>
+    struct HasDrawTarget : std::false_type {};
+
+    template<typename F>
+    struct HasDrawTarget<F, std::void_t<decltype(std::declval<const F &>().getTarget())>>
+        : std::is_pointer<decltype(std::declval<const F &>().getTarget())> {};
+}
+
+template<typename FontType>
+struct ofxIMEFontTraits {
+    static constexpr bool fixedPitch = ofxIMEDetail::HasFixedPitch<FontType>::value;
+    static constexpr bool batchedAdvances = ofxIMEDetail::HasAdvances<FontType>::value;
+    static constexpr bool asyncLoad = ofxIMEDetail::HasPrepare<FontType>::value;
+    static constexpr bool drawTarget = ofxIMEDetail::HasDrawTarget<FontType>::value;
+};
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+template<typename F>
+concept ofxIMEFixedPitchFont = ofxIMEFontTraits<F>::fixedPitch;
+
+template<typename F>
+concept ofxIMEBatchedAdvanceFont = ofxIMEFontTraits<F>::batchedAdvances;
+#endif
+
+// 固定ピッチでの文字幅（セル数）。東アジアの全角文字は2、それ以外は1
+constexpr int ofxIMEColumnWidth(char32_t c) {
+    return (c >= 0x1100 && c <= 0x115F) ||     // Hangul Jamo
+           (c >= 0x2E80 && c <= 0x303E) ||     // CJK radicals, symbols and punctuation
+           (c >= 0x3041 && c <= 0x33FF) ||     // Hiragana, Katakana, CJK compatibility
+           (c >= 0x3400 && c <= 0x4DBF) ||     // CJK extension A
+           (c >= 0x4E00 && c <= 0x9FFF) ||     // CJK unified ideographs
+           (c >= 0xA000 && c <= 0xA4CF) ||     // Yi
+           (c >= 0xAC00 && c <= 0xD7A3) ||     // Hangul syllables
+           (c >= 0xF900 && c <= 0xFAFF) ||     // CJK compatibility ideographs
+           (c >= 0xFE30 && c <= 0xFE4F) ||     // CJK compatibility forms
+           (c >= 0xFF00 && c <= 0xFF60) ||     // Fullwidth forms
+           (c >= 0xFFE0 && c <= 0xFFE6) ||
+           (c >= 0x20000 && c <= 0x3FFFD)      // CJK extension B and later
+        ? 2 : 1;
+}
+
+inline int ofxIMEColumns(std::u32string_view str) {
+    int n = 0;
+    for (char32_t c : str) n += ofxIMEColumnWidth(c);
+    return n;
+}
+
+// 先頭からcolumnセル目に最も近い文字位置
+inline int ofxIMEIndexAtColumn(std::u32string_view str, float column) {
+    int col = 0;
+    for (int i = 0; i < (int)str.size(); ++i) {
+        int w = ofxIMEColumnWidth(str[i]);
+        if (column < col + w * 0.5f) return i;
+        col += w;
+    }
+    return (int)str.size();
+}
@@ -0,0 +1,398 @@
+#include "ofxIMEJournal.h"
+
+#include <array>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+
+#ifdef WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+    const char magic[8] = {'O', 'F', 'X', 'I', 'M', 'E', 'J', 1};
+
+    uint32_t crc32(const char *data, size_t len, uint32_t crc = 0) {
+        static const auto table = [] {
+            std::array<uint32_t, 256> t;
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                t[i] = c;
+            }
+            return t;
+        }();
+        crc = ~crc;
+        for (size_t i = 0; i < len; ++i) {
+            crc = table[(crc ^ (unsigned char)data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    void putVarint(string &dst, uint64_t v) {
+        while (v >= 0x80) {
+            dst += (char)(v | 0x80);
+            v >>= 7;
+        }
+        dst += (char)v;
+    }
+
+    bool getVarint(const char *&p, const char *end, uint64_t &v) {
+        v = 0;
+        for (int shift = 0; p < end && shift < 64; shift += 7) {
+            unsigned char b = *p++;
+            v |= (uint64_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+
+    bool syncFile(FILE *f) {
+        if (fflush(f) != 0) return false;
+#ifdef WIN32
+        return _commit(_fileno(f)) == 0;
+#else
+        return fsync(fileno(f)) == 0;
+#endif
+    }
+
+    bool truncateFile(const string &path, size_t size) {
+#ifdef WIN32
+        int fd = _open(path.c_str(), _O_WRONLY | _O_BINARY);
+        if (fd < 0) return false;
+        bool ok = _chsize_s(fd, size) == 0;
+        _close(fd);
+        return ok;
+#else
+        return truncate(path.c_str(), (off_t)size) == 0;
+#endif
+    }
+
+    bool replaceFile(const string &from, const string &to) {
+#ifdef WIN32
+        return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        return rename(from.c_str(), to.c_str()) == 0;
+#endif
+    }
+}
+
+ofxIMEJournal::~ofxIMEJournal() {
+    close();
+}
+
+bool ofxIMEJournal::open(const string &journalPath, ofxIMEBase &target) {
+    close();
+
+    path = journalPath;
+    ime = &target;
+    bytesSinceCheckpoint = 0;
+    stopping = false;
+
+    // Start from a checkpoint of what the instance holds now
+    string data(magic, sizeof(magic));
+    snapshot(payload);
+    appendRecord(data, RecordSnapshot, payload);
+    if (!writeCheckpoint(data)) {
+        ofLogError("ofxIMEJournal") << "cannot write " << path;
+        ime = nullptr;
+        return false;
+    }
+
+    ofAddListener(ime->editEvent, this, &ofxIMEJournal::onEdit);
+    writer = std::thread(&ofxIMEJournal::writerLoop, this);
+    return true;
+}
+
+void ofxIMEJournal::close() {
+    if (!ime) return;
+
+    ofRemoveListener(ime->editEvent, this, &ofxIMEJournal::onEdit);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cv.notify_all();
+    if (writer.joinable()) writer.join();
+
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+    ime = nullptr;
+}
+
+bool ofxIMEJournal::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!ime) return false;
+    uint64_t target = appendedSeq;
+    uint64_t failuresBefore = failures;
+    flushRequested = true;
+    cv.notify_all();
+    durableCv.wait(lock, [&] { return durableSeq >= target || failures != failuresBefore || stopping; });
+    return durableSeq >= target;
+}
+
+uint64_t ofxIMEJournal::getNumWriteFailures() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return failures;
+}
+
+uint64_t ofxIMEJournal::getNumRecords() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return appendedSeq;
+}
+
+uint64_t ofxIMEJournal::getNumCommits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return commits;
+}
+
+uint64_t ofxIMEJournal::getNumCheckpoints() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return checkpoints;
+}
+
+void ofxIMEJournal::appendRecord(string &dst, RecordType type, const string &body) {
+    size_t begin = dst.size();
+    dst += (char)type;
+    putVarint(dst, body.size());
+    dst += body;
+
+    // CRC over type + payload (the length is implied by a matching CRC)
+    uint32_t crc = crc32(&dst[begin], 1);
+    crc = crc32(body.data(), body.size(), crc);
+    for (int i = 0; i < 4; ++i) dst += (char)(crc >> (i * 8));
+}
+
+void ofxIMEJournal::snapshot(string &body) {
+    body.clear();
+    putVarint(body, ime->getCursorLine());
+    putVarint(body, ime->getCursorPos());
+    ime->getRangeUTF8(0, 0, INT_MAX, INT_MAX, snapshotText);
+    body += snapshotText;
+}
+
+void ofxIMEJournal::onEdit(ofxIMEEdit &e) {
+    payload.clear();
+    RecordType type;
+    switch (e.type) {
+    case ofxIMEEdit::Insert:
+        type = RecordInsert;
+        putVarint(payload, e.line);
+        putVarint(payload, e.pos);
+        ofxIMEBase::UTF32toUTF8(e.text, insertedText);
+        payload += insertedText;
+        break;
+    case ofxIMEEdit::Erase:
+        type = RecordErase;
+        putVarint(payload, e.line);
+        putVarint(payload, e.pos);
+        putVarint(payload, e.endLine);
+        putVarint(payload, e.endPos);
+        break;
+    case ofxIMEEdit::Replace:
+        // One record for all hunks: count, then line, pos, erased and the
+        // length-prefixed UTF-8 of each
+        type = RecordReplace;
+        putVarint(payload, e.numHunks);
+        for (size_t k = 0; k < e.numHunks; ++k) {
+            const ofxIMEEdit::Hunk &h = e.hunks[k];
+            putVarint(payload, h.line);
+            putVarint(payload, h.pos);
+            putVarint(payload, h.erased);
+            ofxIMEBase::UTF32toUTF8(h.text, insertedText);
+            putVarint(payload, insertedText.size());
+            payload += insertedText;
+        }
+        break;
+    default:
+        // The content was replaced as a whole (clear, loadSnapshot)
+        type = RecordSnapshot;
+        snapshot(payload);
+        break;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t before = pending.size();
+        appendRecord(pending, type, payload);
+        bytesSinceCheckpoint += pending.size() - before;
+        appendedSeq++;
+        if (bytesSinceCheckpoint <= checkpointSize) return;
+    }
+
+    // Compaction: everything queued so far is covered by a snapshot. It is
+    // taken without the lock, so the writer can go on committing meanwhile;
+    // what it commits of the old records is replaced with the file anyway
+    checkpointBuffer.assign(magic, sizeof(magic));
+    snapshot(payload);
+    appendRecord(checkpointBuffer, RecordSnapshot, payload);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.clear();
+    pendingCheckpoint.swap(checkpointBuffer);
+    bytesSinceCheckpoint = 0;
+}
+
+bool ofxIMEJournal::writeCheckpoint(const string &data) {
+    // Write the new file next to the journal and swap it in atomically
+    string tmp = path + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(data.data(), 1, data.size(), f) == data.size() && syncFile(f);
+    fclose(f);
+    if (!ok || !replaceFile(tmp, path)) return false;
+
+    if (file) fclose(file);
+    fileSize = data.size();
+    file = fopen(path.c_str(), "ab");
+    return file != nullptr;
+}
+
+bool ofxIMEJournal::appendData(const string &data) {
+    // A failed write may have left part of a record at the end, and recovery
+    // stops at a torn record: cut the file back to the last commit first
+    if (!file) {
+        if (!truncateFile(path, fileSize)) return false;
+        file = fopen(path.c_str(), "ab");
+        if (!file) return false;
+    }
+    if (fwrite(data.data(), 1, data.size(), file) == data.size() && syncFile(file)) {
+        fileSize += data.size();
+        return true;
+    }
+    fclose(file);
+    file = nullptr;
+    return false;
+}
+
+void ofxIMEJournal::writerLoop() {
+    bool failing = false;
+    while (true) {
+        string data, checkpoint;
+        uint64_t seq;
+        bool stop;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait_for(lock, std::chrono::milliseconds(commitIntervalMillis),
+                        [this] { return stopping || flushRequested; });
+            data.swap(pending);
+            checkpoint.swap(pendingCheckpoint);
+            seq = appendedSeq;
+            flushRequested = false;
+            stop = stopping;
+        }
+
+        // Group commit: one write and one fsync for everything queued
+        bool ok = true;
+        if (!checkpoint.empty()) {
+            ok = writeCheckpoint(checkpoint + data);
+            if (ok) checkpoints++;
+        }
+        else if (!data.empty()) {
+            ok = appendData(data);
+        }
+        // Retried every commit; reported once per run of failures
+        if (!ok && (!failing || stop)) {
+            ofLogError("ofxIMEJournal") << "write failed: " << path << (stop ? "" : ", retrying");
+        }
+        else if (ok && failing) {
+            ofLogNotice("ofxIMEJournal") << "writing again: " << path;
+        }
+        failing = !ok;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (ok) {
+                if (!data.empty() || !checkpoint.empty()) commits++;
+                durableSeq = seq;
+            }
+            else {
+                // Not durable: queue it again in front of what came since. A
+                // checkpoint queued meanwhile already covers all of it
+                if (pendingCheckpoint.empty()) {
+                    pendingCheckpoint.swap(checkpoint);
+                    data += pending;
+                    pending.swap(data);
+                }
+                failures++;
+            }
+        }
+        durableCv.notify_all();
+
+        if (stop) return;
+    }
+}
+
+bool ofxIMEJournal::recover(const string &journalPath, ofxIMEBase &target) {
+    std::ifstream in(journalPath, std::ios::binary);
+    if (!in) return false;
+    string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(magic) || data.compare(0, sizeof(magic), magic, sizeof(magic)) != 0) {
+        ofLogError("ofxIMEJournal") << "not a journal: " << journalPath;
+        return false;
+    }
+
+    const char *p = data.data() + sizeof(magic);
+    const char *end = data.data() + data.size();
+    size_t applied = 0;
+    while (p < end) {
+        const char *record = p;
+        uint8_t type = *p++;
+        uint64_t len;
+        if (!getVarint(p, end, len) || (uint64_t)(end - p) < len + 4) break;
+        const char *body = p;
+        const char *bodyEnd = p + len;
+        uint32_t crc = crc32(record, 1);
+        crc = crc32(body, len, crc);
+        uint32_t stored = 0;
+        for (int i = 0; i < 4; ++i) stored |= (uint32_t)(unsigned char)bodyEnd[i] << (i * 8);
+        if (crc != stored) break;
+        p = bodyEnd + 4;
+
+        uint64_t a = 0, b = 0, c = 0, d = 0;
+        switch (type) {
+        case RecordInsert:
+            if (!getVarint(body, bodyEnd, a) || !getVarint(body, bodyEnd, b)) break;
+            target.insertAt((int)a, (int)b, ofxIMEBase::UTF8toUTF32(string(body, bodyEnd)));
+            break;
+        case RecordErase:
+            if (!getVarint(body, bodyEnd, a) || !getVarint(body, bodyEnd, b) ||
+                !getVarint(body, bodyEnd, c) || !getVarint(body, bodyEnd, d)) break;
+            target.eraseRange((int)a, (int)b, (int)c, (int)d);
+            break;
+        case RecordReplace:
+            if (!getVarint(body, bodyEnd, a)) break;
+            for (uint64_t k = 0; k < a; ++k) {
+                uint64_t l, pos, erased, bytes;
+                if (!getVarint(body, bodyEnd, l) || !getVarint(body, bodyEnd, pos) ||
+                    !getVarint(body, bodyEnd, erased) || !getVarint(body, bodyEnd, bytes) ||
+                    (uint64_t)(bodyEnd - body) < bytes) break;
+                target.eraseRange((int)l, (int)pos, (int)l, (int)(pos + erased));
+                target.insertAt((int)l, (int)pos, ofxIMEBase::UTF8toUTF32(string(body, bytes)));
+                body += bytes;
+            }
+            break;
+        case RecordReset:
+            target.clear();
+            break;
+        case RecordSnapshot:
+            if (!getVarint(body, bodyEnd, a) || !getVarint(body, bodyEnd, b)) break;
+            target.setString(string(body, bodyEnd));
+            target.setCursor((int)a, (int)b);
+            break;
+        default:
+            break;
+        }
+        applied++;
+    }
+
+    if (p < end) {
+        ofLogWarning("ofxIMEJournal") << "dropped a torn record at the end of " << journalPath;
+    }
+    return applied > 0;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "ofxIME.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// 編集ジャーナル（追記専用・クラッシュ対策）
+// ofxIMEBase::editEventを購読し、挿入・削除・置き換えを1件ずつ小さなバイナリレコードとして
+// バックグラウンドスレッドで追記する。書き込みはcommitIntervalごとにまとめて
+// 1回のwrite + fsync（group commit）。ファイルがcheckpointSizeを超えたら
+// 文書全体のスナップショット1件に置き換えて圧縮する。
+// スナップショットは編集を通知したスレッドで文書全体をUTF-8にして作るので、
+// 圧縮する編集（checkpointSize分の記録ごとに1回）だけは文書の大きさに比例して時間がかかる。
+// 書き込みに失敗した分は捨てずに残し、次のcommitで書き直す。
+//
+//   ofxIMEJournal::recover(path, ime);   // 前回の内容を復元（あれば）
+//   journal.open(path, ime);             // 以降の編集を記録
+//
+// フォーマット: "OFXIMEJ" + version(1byte)、以降レコードの並び
+//   type(1) + payload長(varint) + payload + CRC32(4, type+payload)
+// 末尾の書きかけレコードはCRCで検出して捨てる
+class ofxIMEJournal {
+public:
+    ofxIMEJournal() = default;
+    ~ofxIMEJournal();
+
+    ofxIMEJournal(const ofxIMEJournal &) = delete;
+    ofxIMEJournal &operator=(const ofxIMEJournal &) = delete;
+
+    // imeの編集の記録を始める。ファイルは現在の内容のチェックポイントで作り直す
+    bool open(const string &path, ofxIMEBase &ime);
+    void close();
+    bool isOpen() const { return ime != nullptr; }
+
+    // ジャーナルを再生してimeを復元する（open前の新しいインスタンスに対して呼ぶ）
+    static bool recover(const string &path, ofxIMEBase &ime);
+
+    void setCommitInterval(int millis) { commitIntervalMillis = millis; }
+    void setCheckpointSize(size_t bytes) { checkpointSize = bytes; }
+
+    // ここまでの編集がディスクに届く（fsyncが終わる）まで待つ
+    // 書き込みに失敗したらそこで戻ってfalse（編集は残してあり、次のcommitで書き直す）
+    bool flush();
+    uint64_t getNumWriteFailures() const;
+
+    uint64_t getNumRecords() const;
+    uint64_t getNumCommits() const;
+    uint64_t getNumCheckpoints() const;
+
+private:
+    enum RecordType : uint8_t {
+        RecordInsert = 1,
+        RecordErase = 2,
+        RecordReset = 3,
+        RecordSnapshot = 4,
+        RecordReplace = 5
+    };
+
+    void onEdit(ofxIMEEdit &e);
+    void appendRecord(string &dst, RecordType type, const string &payload);
+    void snapshot(string &body);
+    void writerLoop();
+    bool writeCheckpoint(const string &data);
+    bool appendData(const string &data);
+
+    ofxIMEBase *ime = nullptr;
+    string path;
+    FILE *file = nullptr;       // nullptrなら、次の追記の前にfileSizeまで切り詰めて開き直す
+    size_t fileSize = 0;        // 最後に書き終えた時点のファイルの長さ
+
+    int commitIntervalMillis = 50;
+    size_t checkpointSize = 4 * 1024 * 1024;
+    size_t bytesSinceCheckpoint = 0;
+
+    // 以下はmutexで保護（ワーカースレッドと共有）
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    std::condition_variable durableCv;
+    string pending;             // 未書き込みのレコード
+    string pendingCheckpoint;   // 空でなければファイルをこれで置き換える
+    uint64_t appendedSeq = 0;
+    uint64_t durableSeq = 0;
+    bool flushRequested = false;
+    bool stopping = false;
+    uint64_t commits = 0;
+    uint64_t checkpoints = 0;
+    uint64_t failures = 0;
+    string payload;             // エンコード用の作業バッファ
+    string insertedText;        // 挿入された文字列のUTF-8
+    string snapshotText;
+    string checkpointBuffer;
+
+    std::thread writer;
+};
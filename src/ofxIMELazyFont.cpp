@@ -0,0 +1,373 @@
+#include "ofxIMELazyFont.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace {
+    FT_Library library = nullptr;
+
+    // FT_New_Face / FT_Done_Face on a shared library must be serialized
+    // (fonts may be prepared on the registry's worker thread)
+    std::mutex libraryMutex;
+
+    bool initLibrary() {
+        if (library) return true;
+        if (FT_Init_FreeType(&library) != 0) {
+            library = nullptr;
+            ofLogError("ofxIMELazyFont") << "failed to initialize FreeType";
+            return false;
+        }
+        return true;
+    }
+
+    // A FreeType bitmap into gray-alpha pixels: white, coverage in alpha
+    void copyCoverage(unsigned char *dst, size_t dstStride, const unsigned char *bitmap, int pitch, int width, int height) {
+        for (int row = 0; row < height; ++row) {
+            const unsigned char *src = bitmap + row * pitch;
+            unsigned char *d = dst + row * dstStride;
+            for (int col = 0; col < width; ++col) {
+                d[col * 2] = 255;
+                d[col * 2 + 1] = src[col];
+            }
+        }
+    }
+}
+
+char32_t ofxIMELazyFont::nextCodepoint(const string &s, size_t &i) {
+    unsigned char c = s[i];
+    char32_t cp;
+    int n;
+    if ((c & 0x80) == 0) { cp = c; n = 1; }
+    else if ((c & 0xE0) == 0xC0) { cp = c & 0x1F; n = 2; }
+    else if ((c & 0xF0) == 0xE0) { cp = c & 0x0F; n = 3; }
+    else { cp = c & 0x07; n = 4; }
+    for (int k = 1; k < n && i + k < s.size(); ++k) {
+        cp = (cp << 6) | (s[i + k] & 0x3F);
+    }
+    i += n;
+    return cp;
+}
+
+ofxIMELazyFont::~ofxIMELazyFont() {
+    unload();
+}
+
+bool ofxIMELazyFont::load(const ofTrueTypeFontSettings &settings) {
+    return load(settings.fontName, settings.fontSize, settings.dpi > 0 ? settings.dpi : 96);
+}
+
+bool ofxIMELazyFont::load(const of::filesystem::path &filename, int size, int dpi) {
+    unload();
+
+    string path = ofToDataPath(filename.string(), true);
+    {
+        std::lock_guard<std::mutex> lock(libraryMutex);
+        if (!initLibrary()) return false;
+        if (FT_New_Face(library, path.c_str(), 0, &face) != 0) {
+            ofLogError("ofxIMELazyFont") << "failed to load " << path;
+            face = nullptr;
+            return false;
+        }
+    }
+    FT_Set_Char_Size(face, size << 6, size << 6, dpi, dpi);
+
+    fontSize = size;
+    lineHeight = face->size->metrics.height / 64.0f;
+    ascender = face->size->metrics.ascender / 64.0f;
+    descender = face->size->metrics.descender / 64.0f;
+    return true;
+}
+
+void ofxIMELazyFont::unload() {
+    currentPage = -1;
+    glyphs.clear();
+    pages.clear();
+    pageStorage.clear();
+    largeGlyphs.clear();
+    meshes.clear();
+    if (face) {
+        std::lock_guard<std::mutex> lock(libraryMutex);
+        FT_Done_Face(face);
+        face = nullptr;
+    }
+}
+
+bool ofxIMELazyFont::prepare(const ofTrueTypeFontSettings &settings) {
+    if (!load(settings)) return false;
+
+    // Warm the atlas with printable ASCII; pages stay on the CPU until the
+    // first draw uploads them, so this is safe off the GL thread
+    for (char32_t c = 0x20; c < 0x7F; ++c) {
+        rasterized(c);
+    }
+    return true;
+}
+
+void ofxIMELazyFont::setPageSize(int size) {
+    if (size == pageSize) return;
+    pageSize = size;
+
+    // Existing pages have the old size; drop them and rasterize again on
+    // demand. Large glyphs may fit the new size
+    for (auto &kv : glyphs) {
+        if (kv.second.page != Glyph::Blank) kv.second.page = Glyph::Unrasterized;
+    }
+    currentPage = -1;
+    pages.clear();
+    pageStorage.clear();
+    largeGlyphs.clear();
+    meshes.clear();
+}
+
+void ofxIMELazyFont::setMemoryLimit(size_t bytes) {
+    memoryLimit = bytes;
+}
+
+size_t ofxIMELazyFont::getAtlasBytes() const {
+    size_t bytes = pages.size() * (size_t)pageSize * pageSize * 2;
+    for (auto &kv : largeGlyphs) bytes += kv.second.pixels.getTotalBytes();
+    return bytes;
+}
+
+const ofxIMELazyFont::Glyph &ofxIMELazyFont::metrics(char32_t c) const {
+    static const Glyph empty;
+    if (!face) return empty;
+
+    auto it = glyphs.find(c);
+    if (it != glyphs.end()) return it->second;
+
+    // First time this code point is measured: load the outline metrics only
+    Glyph g;
+    if (face && FT_Load_Char(face, c, FT_LOAD_DEFAULT) == 0) {
+        g.advance = face->glyph->advance.x / 64.0f;
+    }
+    return glyphs.emplace(c, g).first->second;
+}
+
+const ofxIMELazyFont::Glyph &ofxIMELazyFont::rasterized(char32_t c) const {
+    const Glyph &m = metrics(c);
+    if (m.page >= 0) {
+        // Touch the page so it is not recycled while this frame still needs it
+        pages[m.page]->lastUsedFrame = ofGetFrameNum();
+        return m;
+    }
+    // Blank and large glyphs are rendered once and kept
+    if (m.page != Glyph::Unrasterized || !face) return m;
+
+    Glyph &g = glyphs[c];
+    if (FT_Load_Char(face, c, FT_LOAD_RENDER) != 0) {
+        g.page = Glyph::Blank;
+        return g;
+    }
+
+    FT_GlyphSlot slot = face->glyph;
+    g.left = slot->bitmap_left;
+    g.top = slot->bitmap_top;
+    g.width = slot->bitmap.width;
+    g.height = slot->bitmap.rows;
+    if (g.width <= 0 || g.height <= 0) {
+        g.page = Glyph::Blank;
+    }
+    else if (!place(c, g, slot->bitmap.buffer, slot->bitmap.pitch)) {
+        placeLarge(c, g, slot->bitmap.buffer, slot->bitmap.pitch);
+    }
+    return g;
+}
+
+bool ofxIMELazyFont::place(char32_t c, Glyph &g, const unsigned char *bitmap, int pitch) const {
+    const int pad = 1;
+    if (g.width + pad > pageSize || g.height + pad > pageSize) return false;
+
+    // Shelf packing on the current page, another page when it is full
+    int index = currentPage;
+    Page *page = index >= 0 ? pages[index] : nullptr;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (page) {
+            if (page->shelfX + g.width + pad > pageSize) {
+                page->shelfX = 0;
+                page->shelfY += page->shelfHeight;
+                page->shelfHeight = 0;
+            }
+            if (page->shelfY + g.height + pad <= pageSize) break;
+        }
+        index = currentPage = acquirePage();
+        page = pages[index];
+    }
+
+    g.page = index;
+    g.x = page->shelfX;
+    g.y = page->shelfY;
+    page->shelfX += g.width + pad;
+    page->shelfHeight = MAX(page->shelfHeight, g.height + pad);
+
+    // The page now holds a glyph of this frame, so it must not be the one
+    // recycled for the next glyph of the same string
+    page->lastUsedFrame = ofGetFrameNum();
+
+    copyCoverage(page->pixels.getData() + ((size_t)g.y * pageSize + g.x) * 2, (size_t)pageSize * 2,
+                 bitmap, pitch, g.width, g.height);
+    page->codepoints.push_back(c);
+    page->dirty = true;
+    return true;
+}
+
+void ofxIMELazyFont::placeLarge(char32_t c, Glyph &g, const unsigned char *bitmap, int pitch) const {
+    Page &page = largeGlyphs[c];
+    page.pixels.allocate(g.width, g.height, OF_PIXELS_GRAY_ALPHA);
+    copyCoverage(page.pixels.getData(), (size_t)g.width * 2, bitmap, pitch, g.width, g.height);
+    page.dirty = true;
+    g.page = Glyph::Large;
+    g.x = g.y = 0;
+}
+
+int ofxIMELazyFont::acquirePage() const {
+    size_t pageBytes = (size_t)pageSize * pageSize * 2;
+    uint64_t frame = ofGetFrameNum();
+
+    // Over the limit: recycle the least recently used page, unless every
+    // page is in use this frame (then exceed the limit rather than thrash)
+    if (memoryLimit > 0 && (pages.size() + 1) * pageBytes > memoryLimit && !pages.empty()) {
+        int lru = -1;
+        for (int i = 0; i < (int)pages.size(); ++i) {
+            if (pages[i]->lastUsedFrame == frame) continue;
+            if (lru < 0 || pages[i]->lastUsedFrame < pages[lru]->lastUsedFrame) lru = i;
+        }
+        if (lru >= 0) {
+            evictPage(lru);
+            pages[lru]->lastUsedFrame = frame;
+            return lru;
+        }
+    }
+
+    pageStorage.emplace_back();
+    Page &page = pageStorage.back();
+    page.pixels.allocate(pageSize, pageSize, OF_PIXELS_GRAY_ALPHA);
+    page.pixels.set(0);
+    page.lastUsedFrame = frame;
+    page.dirty = true;
+
+    pages.push_back(&page);
+    return (int)pages.size() - 1;
+}
+
+void ofxIMELazyFont::evictPage(int index) const {
+    Page &page = *pages[index];
+    for (char32_t c : page.codepoints) {
+        auto it = glyphs.find(c);
+        if (it != glyphs.end() && it->second.page == index) {
+            it->second.page = -1;
+        }
+    }
+    page.codepoints.clear();
+    page.pixels.set(0);
+    page.shelfX = page.shelfY = page.shelfHeight = 0;
+    page.dirty = true;
+    evictions++;
+}
+
+float ofxIMELazyFont::stringWidth(const string &s) const {
+    return getStringBoundingBox(s, 0, 0).width;
+}
+
+ofRectangle ofxIMELazyFont::getStringBoundingBox(const string &s, float x, float y) const {
+    float w = 0, maxW = 0;
+    int lines = 1;
+    for (size_t i = 0; i < s.size();) {
+        char32_t c = nextCodepoint(s, i);
+        if (c == U'\n') {
+            maxW = MAX(maxW, w);
+            w = 0;
+            lines++;
+            continue;
+        }
+        w += metrics(c).advance;
+    }
+    maxW = MAX(maxW, w);
+    return ofRectangle(x, y - ascender, maxW, (lines - 1) * lineHeight + ascender - descender);
+}
+
+void ofxIMELazyFont::getAdvances(std::u32string_view str, float *out) const {
+    for (char32_t c : str) {
+        *out++ = metrics(c).advance;
+    }
+}
+
+void ofxIMELazyFont::drawString(const string &s, float x, float y) const {
+    if (!face) return;
+
+    // Rasterize first: a new page may appear or a page may be recycled
+    for (size_t i = 0; i < s.size();) {
+        rasterized(nextCodepoint(s, i));
+    }
+
+    if (meshes.size() < pages.size()) {
+        meshes.resize(pages.size());
+    }
+    for (auto &m : meshes) {
+        m.clear();
+        m.setMode(OF_PRIMITIVE_TRIANGLES);
+    }
+
+    largeDraws.clear();
+
+    float penX = x, penY = y;
+    for (size_t i = 0; i < s.size();) {
+        char32_t c = nextCodepoint(s, i);
+        if (c == U'\n') {
+            penX = x;
+            penY += lineHeight;
+            continue;
+        }
+        const Glyph &g = glyphs[c];
+        if (g.page == Glyph::Large) {
+            largeDraws.emplace_back(&largeGlyphs[c], glm::vec2(penX + g.left, penY - g.top));
+        }
+        else if (g.page >= 0) {
+            float x0 = penX + g.left, y0 = penY - g.top;
+            float x1 = x0 + g.width, y1 = y0 + g.height;
+            float u0 = (float)g.x / pageSize, v0 = (float)g.y / pageSize;
+            float u1 = (float)(g.x + g.width) / pageSize, v1 = (float)(g.y + g.height) / pageSize;
+
+            ofMesh &m = meshes[g.page];
+            ofIndexType base = m.getNumVertices();
+            m.addVertex(glm::vec3(x0, y0, 0)); m.addTexCoord(glm::vec2(u0, v0));
+            m.addVertex(glm::vec3(x1, y0, 0)); m.addTexCoord(glm::vec2(u1, v0));
+            m.addVertex(glm::vec3(x1, y1, 0)); m.addTexCoord(glm::vec2(u1, v1));
+            m.addVertex(glm::vec3(x0, y1, 0)); m.addTexCoord(glm::vec2(u0, v1));
+            m.addIndex(base); m.addIndex(base + 1); m.addIndex(base + 2);
+            m.addIndex(base); m.addIndex(base + 2); m.addIndex(base + 3);
+        }
+        penX += g.advance;
+    }
+
+    // One draw per page touched by this string, and one per large glyph
+    for (int p = 0; p < (int)pages.size(); ++p) {
+        if (meshes[p].getNumVertices() == 0) continue;
+        Page &page = *pages[p];
+        upload(page);
+        page.texture.bind();
+        meshes[p].draw();
+        page.texture.unbind();
+    }
+    for (auto &d : largeDraws) {
+        Page &page = *d.first;
+        upload(page);
+        page.texture.draw(d.second.x, d.second.y, page.pixels.getWidth(), page.pixels.getHeight());
+    }
+}
+
+void ofxIMELazyFont::upload(Page &page) const {
+    if (!page.dirty) return;
+    if (!page.texture.isAllocated()) {
+        // Normalized texture coordinates, like ofTrueTypeFont
+        bool arb = ofGetUsingArbTex();
+        ofDisableArbTex();
+        page.texture.allocate(page.pixels);
+        page.texture.setTextureMinMagFilter(GL_LINEAR, GL_LINEAR);
+        if (arb) ofEnableArbTex();
+    }
+    else {
+        page.texture.loadData(page.pixels);
+    }
+    page.dirty = false;
+}
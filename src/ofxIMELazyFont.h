@@ -0,0 +1,110 @@
+#pragma once
+
+#include "ofMain.h"
+
+#include <list>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+typedef struct FT_FaceRec_ *FT_Face;
+
+// 必要になった文字だけをラスタライズするフォント
+// ofTrueTypeFontは読み込み時に指定範囲の全グリフ（日本語なら数千字）を
+// アトラスに焼くが、こちらは最初に測定・描画された時点でその文字だけを処理する。
+// アトラスはページ単位（既定512x512）で増え、setMemoryLimit()で上限を決めると
+// 最も長く使われていないページから追い出す（メトリクスは残るので測定は変わらない）。
+// ページに入らない大きさのグリフは1字ずつ別に持つ（数が少ないので追い出さない）。
+//
+// ofxIME<ofxIMELazyFont> ime; ime.setFont(path, size); のように使う
+class ofxIMELazyFont {
+public:
+    ofxIMELazyFont() = default;
+    ~ofxIMELazyFont();
+
+    ofxIMELazyFont(const ofxIMELazyFont &) = delete;
+    ofxIMELazyFont &operator=(const ofxIMELazyFont &) = delete;
+
+    // settingsの文字範囲は無視する（すべて遅延で読む）
+    bool load(const ofTrueTypeFontSettings &settings);
+    bool load(const of::filesystem::path &filename, int fontSize, int dpi = 96);
+    bool isLoaded() const { return face != nullptr; }
+    void unload();
+
+    // GLを使わない読み込み（ofxIMEFontRegistryがワーカースレッドから呼ぶ）
+    // ASCIIは先にラスタライズしておき、テクスチャは最初のdrawStringで転送する
+    bool prepare(const ofTrueTypeFontSettings &settings);
+
+    int getSize() const { return fontSize; }
+    float getLineHeight() const { return lineHeight; }
+    float getAscenderHeight() const { return ascender; }
+    float getDescenderHeight() const { return descender; }
+
+    float stringWidth(const string &s) const;
+    ofRectangle getStringBoundingBox(const string &s, float x, float y) const;
+    void drawString(const string &s, float x, float y) const;
+
+    // 一括advance（ofxIMEFontTraits::batchedAdvances）
+    void getAdvances(std::u32string_view str, float *out) const;
+
+    // アトラスの設定
+    void setPageSize(int size);
+    void setMemoryLimit(size_t bytes);   // 0 = 無制限
+
+    size_t getNumGlyphs() const { return glyphs.size(); }
+    size_t getNumPages() const { return pages.size(); }
+    size_t getAtlasBytes() const;
+    size_t getNumEvictions() const { return evictions; }
+
+protected:
+    // ofxIMESoftwareFontはページのピクセルから直接描く
+    struct Glyph {
+        enum {
+            Unrasterized = -1,      // 未ラスタライズ（または追い出し済み）
+            Blank = -2,             // 描く画素がない（空白など）
+            Large = -3              // ページに入らない。largeGlyphsに1字で持つ
+        };
+        float advance = 0;
+        int left = 0, top = 0;      // ビットマップの原点からのオフセット
+        int width = 0, height = 0;
+        int page = Unrasterized;    // 載っているページ（0以上）か上のどれか
+        int x = 0, y = 0;           // ページ内の位置
+    };
+
+    struct Page {
+        ofPixels pixels;
+        ofTexture texture;
+        int shelfX = 0, shelfY = 0, shelfHeight = 0;
+        uint64_t lastUsedFrame = 0;
+        bool dirty = false;
+        vector<char32_t> codepoints;   // このページに載っている文字
+    };
+
+    static char32_t nextCodepoint(const string &s, size_t &i);   // UTF-8を1文字ずつ（確保なし）
+    const Glyph &metrics(char32_t c) const;
+    const Glyph &rasterized(char32_t c) const;
+    bool place(char32_t c, Glyph &g, const unsigned char *bitmap, int pitch) const;
+    void placeLarge(char32_t c, Glyph &g, const unsigned char *bitmap, int pitch) const;
+    int acquirePage() const;
+    void evictPage(int index) const;
+    void upload(Page &page) const;      // 変わったページをテクスチャに送る
+
+    FT_Face face = nullptr;
+    int fontSize = 0;
+    float lineHeight = 0;
+    float ascender = 0;
+    float descender = 0;
+
+    int pageSize = 512;
+    size_t memoryLimit = 0;
+
+    // 描画・測定は論理的にはconstなので、キャッシュはmutable
+    mutable std::unordered_map<char32_t, Glyph> glyphs;
+    mutable std::list<Page> pageStorage;    // ofTextureを動かさないためlist
+    mutable vector<Page *> pages;
+    mutable std::unordered_map<char32_t, Page> largeGlyphs;    // グリフと同じ大きさのページ
+    mutable int currentPage = -1;           // グリフを詰めている途中のページ
+    mutable vector<ofMesh> meshes;          // ページごとの描画用（再利用）
+    mutable vector<pair<Page *, glm::vec2>> largeDraws;   // 大きなグリフの描画位置（再利用）
+    mutable size_t evictions = 0;
+};
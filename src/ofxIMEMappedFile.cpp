@@ -0,0 +1,59 @@
+#include "ofxIMEMappedFile.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool ofxIMEMappedFile::open(const string &path) {
+    close();
+
+#ifdef WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    HANDLE map = fileSize.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    void *view = map ? MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (map) CloseHandle(map);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mapHandle = map;
+    data = view;
+    length = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void *view = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) return false;
+    data = view;
+    length = st.st_size;
+#endif
+    return true;
+}
+
+void ofxIMEMappedFile::close() {
+    if (!data) return;
+#ifdef WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(mapHandle);
+    CloseHandle(fileHandle);
+    mapHandle = fileHandle = nullptr;
+#else
+    munmap(data, length);
+#endif
+    data = nullptr;
+    length = 0;
+}
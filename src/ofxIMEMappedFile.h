@@ -0,0 +1,29 @@
+#pragma once
+
+#include "ofMain.h"
+
+// 読み取り専用のメモリマップ（辞書ファイルを読み込まずにそのまま使うため）
+class ofxIMEMappedFile {
+public:
+    ofxIMEMappedFile() = default;
+    ~ofxIMEMappedFile() { close(); }
+
+    ofxIMEMappedFile(const ofxIMEMappedFile &) = delete;
+    ofxIMEMappedFile &operator=(const ofxIMEMappedFile &) = delete;
+
+    // 空のファイルはマップできない（falseを返す）
+    bool open(const string &path);
+    void close();
+
+    bool isOpen() const { return data != nullptr; }
+    const char *getData() const { return (const char *)data; }
+    size_t size() const { return length; }
+
+private:
+    void *data = nullptr;
+    size_t length = 0;
+#ifdef WIN32
+    void *fileHandle = nullptr;
+    void *mapHandle = nullptr;
+#endif
+};
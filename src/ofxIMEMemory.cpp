@@ -0,0 +1,89 @@
+#include "ofxIMEMemory.h"
+
+#include <algorithm>
+
+void *ofxIMECountingResource::do_allocate(size_t bytes, size_t alignment) {
+    void *p = upstream->allocate(bytes, alignment);
+    allocations++;
+    bytesInUse += bytes;
+    bytesAllocated += bytes;
+    return p;
+}
+
+void ofxIMECountingResource::do_deallocate(void *p, size_t bytes, size_t alignment) {
+    upstream->deallocate(p, bytes, alignment);
+    deallocations++;
+    bytesInUse -= bytes;
+}
+
+ofxIMEFrameArena::ofxIMEFrameArena(std::pmr::memory_resource *upstreamResource)
+    : upstream(upstreamResource) {
+    rebuild(4096);
+}
+
+ofxIMEFrameArena::~ofxIMEFrameArena() {
+    arena.reset();
+    if (buffer) {
+        upstream.deallocate(buffer, bufferSize, alignof(std::max_align_t));
+    }
+}
+
+void ofxIMEFrameArena::rebuild(size_t newSize) {
+    arena.reset();
+    if (buffer) {
+        upstream.deallocate(buffer, bufferSize, alignof(std::max_align_t));
+    }
+    bufferSize = newSize;
+    buffer = static_cast<std::byte *>(upstream.allocate(bufferSize, alignof(std::max_align_t)));
+    arena.emplace(buffer, bufferSize, &upstream);
+    arenaCounter.setUpstream(&*arena);
+}
+
+void ofxIMEFrameArena::reset() {
+    // Close the statistics of the frame that just ended
+    lastUpstreamAllocations = upstream.getAllocations() - upstreamAllocationsAtReset;
+    lastBytes = arenaCounter.getBytesAllocated() - arenaBytesAtReset;
+
+    lastScratchAllocations = 0;
+    for (size_t i = 0; i < scratchStrings.size(); ++i) {
+        if (scratchStrings[i].capacity() != scratchCapacities[i]) {
+            scratchCapacities[i] = scratchStrings[i].capacity();
+            lastScratchAllocations++;
+        }
+    }
+    scratchIndex = 0;
+
+    // The initial buffer overflowed last frame: grow it once so the
+    // following frames fit without touching the upstream resource
+    if (lastBytes > bufferSize) {
+        rebuild(std::max(bufferSize * 2, lastBytes + lastBytes / 2));
+    }
+    else {
+        arena->release();
+    }
+
+    upstreamAllocationsAtReset = upstream.getAllocations();
+    arenaBytesAtReset = arenaCounter.getBytesAllocated();
+}
+
+std::string &ofxIMEFrameArena::scratch() {
+    if (scratchIndex == scratchStrings.size()) {
+        // A new slot is a heap allocation of its own; report it with the frame
+        scratchStrings.emplace_back();
+        scratchCapacities.push_back(size_t(-1));
+    }
+    std::string &s = scratchStrings[scratchIndex++];
+    s.clear();
+    return s;
+}
+
+void ofxIMEFrameArena::setUpstream(std::pmr::memory_resource *upstreamResource) {
+    size_t size = bufferSize;
+    arena.reset();
+    upstream.deallocate(buffer, bufferSize, alignof(std::max_align_t));
+    buffer = nullptr;
+    upstream.setUpstream(upstreamResource);
+    rebuild(size);
+    upstreamAllocationsAtReset = upstream.getAllocations();
+    arenaBytesAtReset = arenaCounter.getBytesAllocated();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <memory_resource>
+#include <optional>
+#include <string>
+
+// 上流のmemory_resourceへの確保・解放回数を数えるラッパー
+// ofxIMEBaseのドキュメント領域やフレームアリーナの上流に挟んで使う
+class ofxIMECountingResource : public std::pmr::memory_resource {
+public:
+    explicit ofxIMECountingResource(std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+        : upstream(upstream) {}
+
+    std::pmr::memory_resource *getUpstream() const { return upstream; }
+
+    // 確保済みのブロックが残っている間は差し替えないこと
+    void setUpstream(std::pmr::memory_resource *r) { upstream = r; }
+
+    size_t getAllocations() const { return allocations; }
+    size_t getDeallocations() const { return deallocations; }
+    size_t getBytesInUse() const { return bytesInUse; }
+    size_t getBytesAllocated() const { return bytesAllocated; }
+
+protected:
+    void *do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    std::pmr::memory_resource *upstream;
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t bytesInUse = 0;
+    size_t bytesAllocated = 0;
+};
+
+// 1フレーム分の一時領域
+// draw()の先頭でreset()し、レイアウト用の一時コンテナはresource()から、
+// フォントAPIに渡すUTF-8文字列はscratch()の再利用バッファから取る。
+// 前フレームで足りなかった分は次のreset()で初期バッファを広げるので、
+// 定常状態のフレームでは上流（ヒープ）を一切呼ばない。
+class ofxIMEFrameArena {
+public:
+    explicit ofxIMEFrameArena(std::pmr::memory_resource *upstream = std::pmr::get_default_resource());
+    ~ofxIMEFrameArena();
+
+    ofxIMEFrameArena(const ofxIMEFrameArena &) = delete;
+    ofxIMEFrameArena &operator=(const ofxIMEFrameArena &) = delete;
+
+    // フレーム開始時に呼ぶ。前フレームの統計を確定して領域を巻き戻す
+    void reset();
+
+    std::pmr::memory_resource *resource() { return &arenaCounter; }
+
+    // 空にした再利用文字列を返す（参照はreset()まで有効）
+    std::string &scratch();
+
+    // 上流を差し替える（確保済みバッファは解放してから付け替える）
+    void setUpstream(std::pmr::memory_resource *upstream);
+
+    // 直前のフレームで発生したヒープ確保の回数
+    size_t getLastFrameUpstreamAllocations() const { return lastUpstreamAllocations; }
+    size_t getLastFrameScratchAllocations() const { return lastScratchAllocations; }
+    size_t getLastFrameBytes() const { return lastBytes; }
+    size_t getCapacity() const { return bufferSize; }
+
+private:
+    void rebuild(size_t newSize);
+
+    ofxIMECountingResource upstream;
+    std::byte *buffer = nullptr;
+    size_t bufferSize = 0;
+    std::optional<std::pmr::monotonic_buffer_resource> arena;
+    ofxIMECountingResource arenaCounter{nullptr};  // arenaへの要求量を測る
+
+    std::deque<std::string> scratchStrings;
+    std::deque<size_t> scratchCapacities;
+    size_t scratchIndex = 0;
+
+    size_t upstreamAllocationsAtReset = 0;
+    size_t arenaBytesAtReset = 0;
+    size_t lastUpstreamAllocations = 0;
+    size_t lastScratchAllocations = 0;
+    size_t lastBytes = 0;
+};
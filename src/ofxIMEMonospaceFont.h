@@ -0,0 +1,39 @@
+#pragma once
+
+#include "ofMain.h"
+
+// 等幅フォントとして扱うofTrueTypeFont
+// ofxIME<ofxIMEMonospaceFont> にすると、カーソル位置やクリック位置の計算が
+// 文字列の計測なしのセル数×セル幅の算術になる（全角は2セル）
+class ofxIMEMonospaceFont : public ofTrueTypeFont {
+public:
+    static constexpr bool fixedPitch = true;
+
+    bool load(const ofTrueTypeFontSettings &settings) {
+        if (!ofTrueTypeFont::load(settings)) return false;
+        updateCellWidth();
+        return true;
+    }
+
+    bool load(const of::filesystem::path &filename, int fontSize, bool antialiased = true,
+              bool fullCharacterSet = true, bool makeContours = false,
+              float simplifyAmt = 0.3f, int dpi = 0) {
+        if (!ofTrueTypeFont::load(filename, fontSize, antialiased, fullCharacterSet, makeContours, simplifyAmt, dpi)) return false;
+        updateCellWidth();
+        return true;
+    }
+
+    // 半角1文字分の送り幅
+    float getCellWidth() const { return cellWidth; }
+
+    // フォントのメトリクスと違う値を使いたい場合（グリッドに揃えるなど）
+    void setCellWidth(float w) { cellWidth = w; }
+
+private:
+    void updateCellWidth() {
+        // The difference of two widths is the advance, not the ink bounds of one glyph
+        cellWidth = stringWidth("00") - stringWidth("0");
+    }
+
+    float cellWidth = 0;
+};
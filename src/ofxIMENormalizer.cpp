@@ -0,0 +1,100 @@
+#include "ofxIMENormalizer.h"
+#include "ofxIMENormalizerTable.h"
+
+namespace {
+    using namespace ofxIMENormalizerTable;
+
+    // Table entries of each 256-character page of the BMP, so a lookup searches
+    // one page and characters of pages without entries (kanji) skip it entirely
+    struct Page {
+        uint16_t begin = 0;
+        uint16_t end = 0;
+    };
+
+    const std::array<Page, 256> &pages() {
+        static const std::array<Page, 256> index = [] {
+            std::array<Page, 256> p{};
+            for (size_t i = 0; i < sizeof(entries) / sizeof(entries[0]); ++i) {
+                Page &page = p[entries[i].codepoint >> 8];
+                if (page.begin == page.end) page.begin = (uint16_t)i;
+                page.end = (uint16_t)(i + 1);
+            }
+            return p;
+        }();
+        return index;
+    }
+
+    const Entry *find(char32_t c) {
+        const Page &p = pages()[c >> 8];
+        const Entry *first = entries + p.begin;
+        const Entry *last = entries + p.end;
+        const Entry *it = std::lower_bound(first, last, c, [](const Entry &e, char32_t c) {
+            return e.codepoint < c;
+        });
+        return it != last && it->codepoint == c ? it : nullptr;
+    }
+
+    char32_t compose(char32_t base, char32_t mark) {
+        for (auto &c : compositions) {
+            if (c.base == base && c.mark == mark) return c.composed;
+        }
+        return 0;
+    }
+
+    bool isVoicedMark(char32_t c) {
+        return c == 0x3099 || c == 0x309A || c == 0xFF9E || c == 0xFF9F;
+    }
+
+    // Whether c can change at all
+    bool mayChange(char32_t c) {
+        if (c < 0x80 || c > 0xFFFF) return false;
+        const Page &p = pages()[c >> 8];
+        return p.begin != p.end || isVoicedMark(c);
+    }
+}
+
+bool ofxIMENormalizer::apply(std::u32string_view src, int flags, u32string &dst) {
+    // Most lines have nothing to change: skip to the first character that might
+    size_t i = 0;
+    while (i < src.size() && !mayChange(src[i])) i++;
+    if (i == src.size()) return false;
+
+    dst.assign(src.data(), i);
+    bool changed = false;
+    for (; i < src.size(); ++i) {
+        char32_t c = src[i];
+        if (c < 0x80) {
+            dst += c;
+            continue;
+        }
+
+        if (flags & FoldKatakana) {
+            // Half-width voiced marks become the combining ones, which then
+            // join the kana before them (ｶﾞ → カ + U+3099 → ガ)
+            if (c == 0xFF9E) c = 0x3099;
+            else if (c == 0xFF9F) c = 0x309A;
+            if ((c == 0x3099 || c == 0x309A) && !dst.empty()) {
+                char32_t composed = compose(dst.back(), c);
+                if (composed) {
+                    dst.back() = composed;
+                    changed = true;
+                    continue;
+                }
+            }
+            if (c != src[i]) {
+                dst += c;
+                changed = true;
+                continue;
+            }
+        }
+
+        const Entry *e = c <= 0xFFFF ? find(c) : nullptr;
+        if (e && (flags & e->category)) {
+            dst.append(pool + e->offset, e->length);
+            changed = true;
+            continue;
+        }
+        dst += c;
+    }
+    return changed;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ofMain.h"
+
+#include <string_view>
+
+// 文字列の正規化（表引き）
+// NFKCのうち、日本語の入力に関係する置き換えだけを行う:
+//   全角英数字・記号・空白 → 半角、半角カナ → 全角カナ（濁点・半濁点は合成する）、
+//   ①・㍻・㌔などの互換文字とCJK互換漢字 → 対応する文字（列）
+// かな以外の結合文字の合成と並べ替えはしない
+class ofxIMENormalizer {
+public:
+    enum Flags {
+        FoldAlphanumeric = 1 << 0,  // 全角英数字・記号・空白 → 半角
+        FoldKatakana = 1 << 1,      // 半角カナ → 全角カナ、かな + 結合用濁点 → 合成済みの文字
+        Compatibility = 1 << 2,     // その他の互換文字
+        NFKC = FoldAlphanumeric | FoldKatakana | Compatibility
+    };
+
+    // srcを変換してdstに入れる。変わる文字がなければfalse（dstは不定）
+    static bool apply(std::u32string_view src, int flags, u32string &dst);
+};
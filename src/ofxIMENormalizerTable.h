@@ -0,0 +1,861 @@
+#pragma once
+
+// ofxIMENormalizer.cppだけが読み込む変換表
+// Pythonのunicodedata（Unicode 14.0.0）のNFKCから、日本語の入力に関係するブロックの
+// 1文字→文字列の置き換えを抜き出したもの（結合文字を含む結果は除く）。手で編集しないこと
+
+namespace ofxIMENormalizerTable {
+
+struct Entry {
+    char32_t codepoint;
+    uint16_t offset;    // poolの位置
+    uint8_t length;
+    uint8_t category;   // ofxIMENormalizer::Flagsの1ビット
+};
+
+enum : uint8_t { Alnum = 1, Kana = 2, Compat = 4 };
+
+const Entry entries[] = {
+    {0x00A0, 0, 1, Compat}, {0x00AA, 1, 1, Compat}, {0x00B2, 2, 1, Compat}, {0x00B3, 3, 1, Compat},
+    {0x00B5, 4, 1, Compat}, {0x00B9, 5, 1, Compat}, {0x00BA, 6, 1, Compat}, {0x00BC, 7, 3, Compat},
+    {0x00BD, 10, 3, Compat}, {0x00BE, 13, 3, Compat}, {0x2000, 0, 1, Compat},
+    {0x2001, 0, 1, Compat}, {0x2002, 0, 1, Compat}, {0x2003, 0, 1, Compat}, {0x2004, 0, 1, Compat},
+    {0x2005, 0, 1, Compat}, {0x2006, 0, 1, Compat}, {0x2007, 0, 1, Compat}, {0x2008, 0, 1, Compat},
+    {0x2009, 0, 1, Compat}, {0x200A, 0, 1, Compat}, {0x2011, 16, 1, Compat},
+    {0x2024, 17, 1, Compat}, {0x2025, 18, 2, Compat}, {0x2026, 17, 3, Compat},
+    {0x202F, 0, 1, Compat}, {0x2033, 20, 2, Compat}, {0x2034, 22, 3, Compat},
+    {0x2036, 25, 2, Compat}, {0x2037, 27, 3, Compat}, {0x203C, 30, 2, Compat},
+    {0x2047, 32, 2, Compat}, {0x2048, 34, 2, Compat}, {0x2049, 31, 2, Compat},
+    {0x2057, 20, 4, Compat}, {0x205F, 0, 1, Compat}, {0x2070, 36, 1, Compat},
+    {0x2071, 37, 1, Compat}, {0x2074, 9, 1, Compat}, {0x2075, 38, 1, Compat},
+    {0x2076, 39, 1, Compat}, {0x2077, 40, 1, Compat}, {0x2078, 41, 1, Compat},
+    {0x2079, 42, 1, Compat}, {0x207A, 43, 1, Compat}, {0x207B, 44, 1, Compat},
+    {0x207C, 45, 1, Compat}, {0x207D, 46, 1, Compat}, {0x207E, 47, 1, Compat},
+    {0x207F, 48, 1, Compat}, {0x2080, 36, 1, Compat}, {0x2081, 5, 1, Compat},
+    {0x2082, 2, 1, Compat}, {0x2083, 3, 1, Compat}, {0x2084, 9, 1, Compat}, {0x2085, 38, 1, Compat},
+    {0x2086, 39, 1, Compat}, {0x2087, 40, 1, Compat}, {0x2088, 41, 1, Compat},
+    {0x2089, 42, 1, Compat}, {0x208A, 43, 1, Compat}, {0x208B, 44, 1, Compat},
+    {0x208C, 45, 1, Compat}, {0x208D, 46, 1, Compat}, {0x208E, 47, 1, Compat},
+    {0x2090, 1, 1, Compat}, {0x2091, 49, 1, Compat}, {0x2092, 6, 1, Compat},
+    {0x2093, 50, 1, Compat}, {0x2094, 51, 1, Compat}, {0x2095, 52, 1, Compat},
+    {0x2096, 53, 1, Compat}, {0x2097, 54, 1, Compat}, {0x2098, 55, 1, Compat},
+    {0x2099, 48, 1, Compat}, {0x209A, 56, 1, Compat}, {0x209B, 57, 1, Compat},
+    {0x209C, 58, 1, Compat}, {0x2100, 59, 3, Compat}, {0x2101, 62, 3, Compat},
+    {0x2102, 65, 1, Compat}, {0x2103, 66, 2, Compat}, {0x2105, 68, 3, Compat},
+    {0x2106, 71, 3, Compat}, {0x2107, 74, 1, Compat}, {0x2109, 75, 2, Compat},
+    {0x210A, 77, 1, Compat}, {0x210B, 78, 1, Compat}, {0x210C, 78, 1, Compat},
+    {0x210D, 78, 1, Compat}, {0x210E, 52, 1, Compat}, {0x210F, 79, 1, Compat},
+    {0x2110, 80, 1, Compat}, {0x2111, 80, 1, Compat}, {0x2112, 81, 1, Compat},
+    {0x2113, 54, 1, Compat}, {0x2115, 82, 1, Compat}, {0x2116, 83, 2, Compat},
+    {0x2119, 85, 1, Compat}, {0x211A, 86, 1, Compat}, {0x211B, 87, 1, Compat},
+    {0x211C, 87, 1, Compat}, {0x211D, 87, 1, Compat}, {0x2120, 88, 2, Compat},
+    {0x2121, 90, 3, Compat}, {0x2122, 93, 2, Compat}, {0x2124, 95, 1, Compat},
+    {0x2126, 96, 1, Compat}, {0x2128, 95, 1, Compat}, {0x212A, 97, 1, Compat},
+    {0x212B, 98, 1, Compat}, {0x212C, 99, 1, Compat}, {0x212D, 65, 1, Compat},
+    {0x212F, 49, 1, Compat}, {0x2130, 91, 1, Compat}, {0x2131, 76, 1, Compat},
+    {0x2133, 89, 1, Compat}, {0x2134, 6, 1, Compat}, {0x2135, 100, 1, Compat},
+    {0x2136, 101, 1, Compat}, {0x2137, 102, 1, Compat}, {0x2138, 103, 1, Compat},
+    {0x2139, 37, 1, Compat}, {0x213B, 104, 3, Compat}, {0x213C, 107, 1, Compat},
+    {0x213D, 108, 1, Compat}, {0x213E, 109, 1, Compat}, {0x213F, 110, 1, Compat},
+    {0x2140, 111, 1, Compat}, {0x2145, 112, 1, Compat}, {0x2146, 113, 1, Compat},
+    {0x2147, 49, 1, Compat}, {0x2148, 37, 1, Compat}, {0x2149, 114, 1, Compat},
+    {0x2150, 115, 3, Compat}, {0x2151, 118, 3, Compat}, {0x2152, 121, 4, Compat},
+    {0x2153, 125, 3, Compat}, {0x2154, 128, 3, Compat}, {0x2155, 131, 3, Compat},
+    {0x2156, 134, 3, Compat}, {0x2157, 137, 3, Compat}, {0x2158, 140, 3, Compat},
+    {0x2159, 143, 3, Compat}, {0x215A, 146, 3, Compat}, {0x215B, 149, 3, Compat},
+    {0x215C, 152, 3, Compat}, {0x215D, 155, 3, Compat}, {0x215E, 158, 3, Compat},
+    {0x215F, 7, 2, Compat}, {0x2160, 80, 1, Compat}, {0x2161, 161, 2, Compat},
+    {0x2162, 163, 3, Compat}, {0x2163, 166, 2, Compat}, {0x2164, 167, 1, Compat},
+    {0x2165, 168, 2, Compat}, {0x2166, 170, 3, Compat}, {0x2167, 173, 4, Compat},
+    {0x2168, 177, 2, Compat}, {0x2169, 106, 1, Compat}, {0x216A, 179, 2, Compat},
+    {0x216B, 181, 3, Compat}, {0x216C, 81, 1, Compat}, {0x216D, 65, 1, Compat},
+    {0x216E, 112, 1, Compat}, {0x216F, 89, 1, Compat}, {0x2170, 37, 1, Compat},
+    {0x2171, 184, 2, Compat}, {0x2172, 186, 3, Compat}, {0x2173, 189, 2, Compat},
+    {0x2174, 190, 1, Compat}, {0x2175, 191, 2, Compat}, {0x2176, 193, 3, Compat},
+    {0x2177, 196, 4, Compat}, {0x2178, 200, 2, Compat}, {0x2179, 50, 1, Compat},
+    {0x217A, 202, 2, Compat}, {0x217B, 204, 3, Compat}, {0x217C, 54, 1, Compat},
+    {0x217D, 61, 1, Compat}, {0x217E, 113, 1, Compat}, {0x217F, 55, 1, Compat},
+    {0x2189, 207, 3, Compat}, {0x2460, 5, 1, Compat}, {0x2461, 2, 1, Compat},
+    {0x2462, 3, 1, Compat}, {0x2463, 9, 1, Compat}, {0x2464, 38, 1, Compat},
+    {0x2465, 39, 1, Compat}, {0x2466, 40, 1, Compat}, {0x2467, 41, 1, Compat},
+    {0x2468, 42, 1, Compat}, {0x2469, 123, 2, Compat}, {0x246A, 210, 2, Compat},
+    {0x246B, 212, 2, Compat}, {0x246C, 214, 2, Compat}, {0x246D, 216, 2, Compat},
+    {0x246E, 218, 2, Compat}, {0x246F, 220, 2, Compat}, {0x2470, 222, 2, Compat},
+    {0x2471, 224, 2, Compat}, {0x2472, 226, 2, Compat}, {0x2473, 228, 2, Compat},
+    {0x2474, 230, 3, Compat}, {0x2475, 233, 3, Compat}, {0x2476, 236, 3, Compat},
+    {0x2477, 239, 3, Compat}, {0x2478, 242, 3, Compat}, {0x2479, 245, 3, Compat},
+    {0x247A, 248, 3, Compat}, {0x247B, 251, 3, Compat}, {0x247C, 254, 3, Compat},
+    {0x247D, 257, 4, Compat}, {0x247E, 261, 4, Compat}, {0x247F, 265, 4, Compat},
+    {0x2480, 269, 4, Compat}, {0x2481, 273, 4, Compat}, {0x2482, 277, 4, Compat},
+    {0x2483, 281, 4, Compat}, {0x2484, 285, 4, Compat}, {0x2485, 289, 4, Compat},
+    {0x2486, 293, 4, Compat}, {0x2487, 297, 4, Compat}, {0x2488, 301, 2, Compat},
+    {0x2489, 303, 2, Compat}, {0x248A, 305, 2, Compat}, {0x248B, 307, 2, Compat},
+    {0x248C, 309, 2, Compat}, {0x248D, 311, 2, Compat}, {0x248E, 313, 2, Compat},
+    {0x248F, 315, 2, Compat}, {0x2490, 317, 2, Compat}, {0x2491, 319, 3, Compat},
+    {0x2492, 322, 3, Compat}, {0x2493, 325, 3, Compat}, {0x2494, 328, 3, Compat},
+    {0x2495, 331, 3, Compat}, {0x2496, 334, 3, Compat}, {0x2497, 337, 3, Compat},
+    {0x2498, 340, 3, Compat}, {0x2499, 343, 3, Compat}, {0x249A, 346, 3, Compat},
+    {0x249B, 349, 3, Compat}, {0x249C, 352, 3, Compat}, {0x249D, 355, 3, Compat},
+    {0x249E, 358, 3, Compat}, {0x249F, 361, 3, Compat}, {0x24A0, 364, 3, Compat},
+    {0x24A1, 367, 3, Compat}, {0x24A2, 370, 3, Compat}, {0x24A3, 373, 3, Compat},
+    {0x24A4, 376, 3, Compat}, {0x24A5, 379, 3, Compat}, {0x24A6, 382, 3, Compat},
+    {0x24A7, 385, 3, Compat}, {0x24A8, 388, 3, Compat}, {0x24A9, 391, 3, Compat},
+    {0x24AA, 394, 3, Compat}, {0x24AB, 397, 3, Compat}, {0x24AC, 400, 3, Compat},
+    {0x24AD, 403, 3, Compat}, {0x24AE, 406, 3, Compat}, {0x24AF, 409, 3, Compat},
+    {0x24B0, 412, 3, Compat}, {0x24B1, 415, 3, Compat}, {0x24B2, 418, 3, Compat},
+    {0x24B3, 421, 3, Compat}, {0x24B4, 424, 3, Compat}, {0x24B5, 427, 3, Compat},
+    {0x24B6, 105, 1, Compat}, {0x24B7, 99, 1, Compat}, {0x24B8, 65, 1, Compat},
+    {0x24B9, 112, 1, Compat}, {0x24BA, 91, 1, Compat}, {0x24BB, 76, 1, Compat},
+    {0x24BC, 430, 1, Compat}, {0x24BD, 78, 1, Compat}, {0x24BE, 80, 1, Compat},
+    {0x24BF, 431, 1, Compat}, {0x24C0, 97, 1, Compat}, {0x24C1, 81, 1, Compat},
+    {0x24C2, 89, 1, Compat}, {0x24C3, 82, 1, Compat}, {0x24C4, 432, 1, Compat},
+    {0x24C5, 85, 1, Compat}, {0x24C6, 86, 1, Compat}, {0x24C7, 87, 1, Compat},
+    {0x24C8, 88, 1, Compat}, {0x24C9, 90, 1, Compat}, {0x24CA, 433, 1, Compat},
+    {0x24CB, 167, 1, Compat}, {0x24CC, 434, 1, Compat}, {0x24CD, 106, 1, Compat},
+    {0x24CE, 435, 1, Compat}, {0x24CF, 95, 1, Compat}, {0x24D0, 1, 1, Compat},
+    {0x24D1, 356, 1, Compat}, {0x24D2, 61, 1, Compat}, {0x24D3, 113, 1, Compat},
+    {0x24D4, 49, 1, Compat}, {0x24D5, 368, 1, Compat}, {0x24D6, 77, 1, Compat},
+    {0x24D7, 52, 1, Compat}, {0x24D8, 37, 1, Compat}, {0x24D9, 114, 1, Compat},
+    {0x24DA, 53, 1, Compat}, {0x24DB, 54, 1, Compat}, {0x24DC, 55, 1, Compat},
+    {0x24DD, 48, 1, Compat}, {0x24DE, 6, 1, Compat}, {0x24DF, 56, 1, Compat},
+    {0x24E0, 401, 1, Compat}, {0x24E1, 404, 1, Compat}, {0x24E2, 57, 1, Compat},
+    {0x24E3, 58, 1, Compat}, {0x24E4, 73, 1, Compat}, {0x24E5, 190, 1, Compat},
+    {0x24E6, 419, 1, Compat}, {0x24E7, 50, 1, Compat}, {0x24E8, 425, 1, Compat},
+    {0x24E9, 428, 1, Compat}, {0x24EA, 36, 1, Compat}, {0x2E9F, 436, 1, Compat},
+    {0x2EF3, 437, 1, Compat}, {0x2F00, 438, 1, Compat}, {0x2F01, 439, 1, Compat},
+    {0x2F02, 440, 1, Compat}, {0x2F03, 441, 1, Compat}, {0x2F04, 442, 1, Compat},
+    {0x2F05, 443, 1, Compat}, {0x2F06, 444, 1, Compat}, {0x2F07, 445, 1, Compat},
+    {0x2F08, 446, 1, Compat}, {0x2F09, 447, 1, Compat}, {0x2F0A, 448, 1, Compat},
+    {0x2F0B, 449, 1, Compat}, {0x2F0C, 450, 1, Compat}, {0x2F0D, 451, 1, Compat},
+    {0x2F0E, 452, 1, Compat}, {0x2F0F, 453, 1, Compat}, {0x2F10, 454, 1, Compat},
+    {0x2F11, 455, 1, Compat}, {0x2F12, 456, 1, Compat}, {0x2F13, 457, 1, Compat},
+    {0x2F14, 458, 1, Compat}, {0x2F15, 459, 1, Compat}, {0x2F16, 460, 1, Compat},
+    {0x2F17, 461, 1, Compat}, {0x2F18, 462, 1, Compat}, {0x2F19, 463, 1, Compat},
+    {0x2F1A, 464, 1, Compat}, {0x2F1B, 465, 1, Compat}, {0x2F1C, 466, 1, Compat},
+    {0x2F1D, 467, 1, Compat}, {0x2F1E, 468, 1, Compat}, {0x2F1F, 469, 1, Compat},
+    {0x2F20, 470, 1, Compat}, {0x2F21, 471, 1, Compat}, {0x2F22, 472, 1, Compat},
+    {0x2F23, 473, 1, Compat}, {0x2F24, 474, 1, Compat}, {0x2F25, 475, 1, Compat},
+    {0x2F26, 476, 1, Compat}, {0x2F27, 477, 1, Compat}, {0x2F28, 478, 1, Compat},
+    {0x2F29, 479, 1, Compat}, {0x2F2A, 480, 1, Compat}, {0x2F2B, 481, 1, Compat},
+    {0x2F2C, 482, 1, Compat}, {0x2F2D, 483, 1, Compat}, {0x2F2E, 484, 1, Compat},
+    {0x2F2F, 485, 1, Compat}, {0x2F30, 486, 1, Compat}, {0x2F31, 487, 1, Compat},
+    {0x2F32, 488, 1, Compat}, {0x2F33, 489, 1, Compat}, {0x2F34, 490, 1, Compat},
+    {0x2F35, 491, 1, Compat}, {0x2F36, 492, 1, Compat}, {0x2F37, 493, 1, Compat},
+    {0x2F38, 494, 1, Compat}, {0x2F39, 495, 1, Compat}, {0x2F3A, 496, 1, Compat},
+    {0x2F3B, 497, 1, Compat}, {0x2F3C, 498, 1, Compat}, {0x2F3D, 499, 1, Compat},
+    {0x2F3E, 500, 1, Compat}, {0x2F3F, 501, 1, Compat}, {0x2F40, 502, 1, Compat},
+    {0x2F41, 503, 1, Compat}, {0x2F42, 504, 1, Compat}, {0x2F43, 505, 1, Compat},
+    {0x2F44, 506, 1, Compat}, {0x2F45, 507, 1, Compat}, {0x2F46, 508, 1, Compat},
+    {0x2F47, 509, 1, Compat}, {0x2F48, 510, 1, Compat}, {0x2F49, 511, 1, Compat},
+    {0x2F4A, 512, 1, Compat}, {0x2F4B, 513, 1, Compat}, {0x2F4C, 514, 1, Compat},
+    {0x2F4D, 515, 1, Compat}, {0x2F4E, 516, 1, Compat}, {0x2F4F, 517, 1, Compat},
+    {0x2F50, 518, 1, Compat}, {0x2F51, 519, 1, Compat}, {0x2F52, 520, 1, Compat},
+    {0x2F53, 521, 1, Compat}, {0x2F54, 522, 1, Compat}, {0x2F55, 523, 1, Compat},
+    {0x2F56, 524, 1, Compat}, {0x2F57, 525, 1, Compat}, {0x2F58, 526, 1, Compat},
+    {0x2F59, 527, 1, Compat}, {0x2F5A, 528, 1, Compat}, {0x2F5B, 529, 1, Compat},
+    {0x2F5C, 530, 1, Compat}, {0x2F5D, 531, 1, Compat}, {0x2F5E, 532, 1, Compat},
+    {0x2F5F, 533, 1, Compat}, {0x2F60, 534, 1, Compat}, {0x2F61, 535, 1, Compat},
+    {0x2F62, 536, 1, Compat}, {0x2F63, 537, 1, Compat}, {0x2F64, 538, 1, Compat},
+    {0x2F65, 539, 1, Compat}, {0x2F66, 540, 1, Compat}, {0x2F67, 541, 1, Compat},
+    {0x2F68, 542, 1, Compat}, {0x2F69, 543, 1, Compat}, {0x2F6A, 544, 1, Compat},
+    {0x2F6B, 545, 1, Compat}, {0x2F6C, 546, 1, Compat}, {0x2F6D, 547, 1, Compat},
+    {0x2F6E, 548, 1, Compat}, {0x2F6F, 549, 1, Compat}, {0x2F70, 550, 1, Compat},
+    {0x2F71, 551, 1, Compat}, {0x2F72, 552, 1, Compat}, {0x2F73, 553, 1, Compat},
+    {0x2F74, 554, 1, Compat}, {0x2F75, 555, 1, Compat}, {0x2F76, 556, 1, Compat},
+    {0x2F77, 557, 1, Compat}, {0x2F78, 558, 1, Compat}, {0x2F79, 559, 1, Compat},
+    {0x2F7A, 560, 1, Compat}, {0x2F7B, 561, 1, Compat}, {0x2F7C, 562, 1, Compat},
+    {0x2F7D, 563, 1, Compat}, {0x2F7E, 564, 1, Compat}, {0x2F7F, 565, 1, Compat},
+    {0x2F80, 566, 1, Compat}, {0x2F81, 567, 1, Compat}, {0x2F82, 568, 1, Compat},
+    {0x2F83, 569, 1, Compat}, {0x2F84, 570, 1, Compat}, {0x2F85, 571, 1, Compat},
+    {0x2F86, 572, 1, Compat}, {0x2F87, 573, 1, Compat}, {0x2F88, 574, 1, Compat},
+    {0x2F89, 575, 1, Compat}, {0x2F8A, 576, 1, Compat}, {0x2F8B, 577, 1, Compat},
+    {0x2F8C, 578, 1, Compat}, {0x2F8D, 579, 1, Compat}, {0x2F8E, 580, 1, Compat},
+    {0x2F8F, 581, 1, Compat}, {0x2F90, 582, 1, Compat}, {0x2F91, 583, 1, Compat},
+    {0x2F92, 584, 1, Compat}, {0x2F93, 585, 1, Compat}, {0x2F94, 586, 1, Compat},
+    {0x2F95, 587, 1, Compat}, {0x2F96, 588, 1, Compat}, {0x2F97, 589, 1, Compat},
+    {0x2F98, 590, 1, Compat}, {0x2F99, 591, 1, Compat}, {0x2F9A, 592, 1, Compat},
+    {0x2F9B, 593, 1, Compat}, {0x2F9C, 594, 1, Compat}, {0x2F9D, 595, 1, Compat},
+    {0x2F9E, 596, 1, Compat}, {0x2F9F, 597, 1, Compat}, {0x2FA0, 598, 1, Compat},
+    {0x2FA1, 599, 1, Compat}, {0x2FA2, 600, 1, Compat}, {0x2FA3, 601, 1, Compat},
+    {0x2FA4, 602, 1, Compat}, {0x2FA5, 603, 1, Compat}, {0x2FA6, 604, 1, Compat},
+    {0x2FA7, 605, 1, Compat}, {0x2FA8, 606, 1, Compat}, {0x2FA9, 607, 1, Compat},
+    {0x2FAA, 608, 1, Compat}, {0x2FAB, 609, 1, Compat}, {0x2FAC, 610, 1, Compat},
+    {0x2FAD, 611, 1, Compat}, {0x2FAE, 612, 1, Compat}, {0x2FAF, 613, 1, Compat},
+    {0x2FB0, 614, 1, Compat}, {0x2FB1, 615, 1, Compat}, {0x2FB2, 616, 1, Compat},
+    {0x2FB3, 617, 1, Compat}, {0x2FB4, 618, 1, Compat}, {0x2FB5, 619, 1, Compat},
+    {0x2FB6, 620, 1, Compat}, {0x2FB7, 621, 1, Compat}, {0x2FB8, 622, 1, Compat},
+    {0x2FB9, 623, 1, Compat}, {0x2FBA, 624, 1, Compat}, {0x2FBB, 625, 1, Compat},
+    {0x2FBC, 626, 1, Compat}, {0x2FBD, 627, 1, Compat}, {0x2FBE, 628, 1, Compat},
+    {0x2FBF, 629, 1, Compat}, {0x2FC0, 630, 1, Compat}, {0x2FC1, 631, 1, Compat},
+    {0x2FC2, 632, 1, Compat}, {0x2FC3, 633, 1, Compat}, {0x2FC4, 634, 1, Compat},
+    {0x2FC5, 635, 1, Compat}, {0x2FC6, 636, 1, Compat}, {0x2FC7, 637, 1, Compat},
+    {0x2FC8, 638, 1, Compat}, {0x2FC9, 639, 1, Compat}, {0x2FCA, 640, 1, Compat},
+    {0x2FCB, 641, 1, Compat}, {0x2FCC, 642, 1, Compat}, {0x2FCD, 643, 1, Compat},
+    {0x2FCE, 644, 1, Compat}, {0x2FCF, 645, 1, Compat}, {0x2FD0, 646, 1, Compat},
+    {0x2FD1, 647, 1, Compat}, {0x2FD2, 648, 1, Compat}, {0x2FD3, 649, 1, Compat},
+    {0x2FD4, 650, 1, Compat}, {0x2FD5, 651, 1, Compat}, {0x3000, 0, 1, Alnum},
+    {0x3036, 652, 1, Compat}, {0x3038, 461, 1, Compat}, {0x3039, 653, 1, Compat},
+    {0x303A, 654, 1, Compat}, {0x309F, 655, 2, Compat}, {0x30FF, 657, 2, Compat},
+    {0x3131, 659, 1, Compat}, {0x3132, 660, 1, Compat}, {0x3133, 661, 1, Compat},
+    {0x3134, 662, 1, Compat}, {0x3135, 663, 1, Compat}, {0x3136, 664, 1, Compat},
+    {0x3137, 665, 1, Compat}, {0x3138, 666, 1, Compat}, {0x3139, 667, 1, Compat},
+    {0x313A, 668, 1, Compat}, {0x313B, 669, 1, Compat}, {0x313C, 670, 1, Compat},
+    {0x313D, 671, 1, Compat}, {0x313E, 672, 1, Compat}, {0x313F, 673, 1, Compat},
+    {0x3140, 674, 1, Compat}, {0x3141, 675, 1, Compat}, {0x3142, 676, 1, Compat},
+    {0x3143, 677, 1, Compat}, {0x3144, 678, 1, Compat}, {0x3145, 679, 1, Compat},
+    {0x3146, 680, 1, Compat}, {0x3147, 681, 1, Compat}, {0x3148, 682, 1, Compat},
+    {0x3149, 683, 1, Compat}, {0x314A, 684, 1, Compat}, {0x314B, 685, 1, Compat},
+    {0x314C, 686, 1, Compat}, {0x314D, 687, 1, Compat}, {0x314E, 688, 1, Compat},
+    {0x314F, 689, 1, Compat}, {0x3150, 690, 1, Compat}, {0x3151, 691, 1, Compat},
+    {0x3152, 692, 1, Compat}, {0x3153, 693, 1, Compat}, {0x3154, 694, 1, Compat},
+    {0x3155, 695, 1, Compat}, {0x3156, 696, 1, Compat}, {0x3157, 697, 1, Compat},
+    {0x3158, 698, 1, Compat}, {0x3159, 699, 1, Compat}, {0x315A, 700, 1, Compat},
+    {0x315B, 701, 1, Compat}, {0x315C, 702, 1, Compat}, {0x315D, 703, 1, Compat},
+    {0x315E, 704, 1, Compat}, {0x315F, 705, 1, Compat}, {0x3160, 706, 1, Compat},
+    {0x3161, 707, 1, Compat}, {0x3162, 708, 1, Compat}, {0x3163, 709, 1, Compat},
+    {0x3164, 710, 1, Compat}, {0x3165, 711, 1, Compat}, {0x3166, 712, 1, Compat},
+    {0x3167, 713, 1, Compat}, {0x3168, 714, 1, Compat}, {0x3169, 715, 1, Compat},
+    {0x316A, 716, 1, Compat}, {0x316B, 717, 1, Compat}, {0x316C, 718, 1, Compat},
+    {0x316D, 719, 1, Compat}, {0x316E, 720, 1, Compat}, {0x316F, 721, 1, Compat},
+    {0x3170, 722, 1, Compat}, {0x3171, 723, 1, Compat}, {0x3172, 724, 1, Compat},
+    {0x3173, 725, 1, Compat}, {0x3174, 726, 1, Compat}, {0x3175, 727, 1, Compat},
+    {0x3176, 728, 1, Compat}, {0x3177, 729, 1, Compat}, {0x3178, 730, 1, Compat},
+    {0x3179, 731, 1, Compat}, {0x317A, 732, 1, Compat}, {0x317B, 733, 1, Compat},
+    {0x317C, 734, 1, Compat}, {0x317D, 735, 1, Compat}, {0x317E, 736, 1, Compat},
+    {0x317F, 737, 1, Compat}, {0x3180, 738, 1, Compat}, {0x3181, 739, 1, Compat},
+    {0x3182, 740, 1, Compat}, {0x3183, 741, 1, Compat}, {0x3184, 742, 1, Compat},
+    {0x3185, 743, 1, Compat}, {0x3186, 744, 1, Compat}, {0x3187, 745, 1, Compat},
+    {0x3188, 746, 1, Compat}, {0x3189, 747, 1, Compat}, {0x318A, 748, 1, Compat},
+    {0x318B, 749, 1, Compat}, {0x318C, 750, 1, Compat}, {0x318D, 751, 1, Compat},
+    {0x318E, 752, 1, Compat}, {0x3192, 438, 1, Compat}, {0x3193, 444, 1, Compat},
+    {0x3194, 753, 1, Compat}, {0x3195, 754, 1, Compat}, {0x3196, 755, 1, Compat},
+    {0x3197, 756, 1, Compat}, {0x3198, 757, 1, Compat}, {0x3199, 758, 1, Compat},
+    {0x319A, 442, 1, Compat}, {0x319B, 759, 1, Compat}, {0x319C, 760, 1, Compat},
+    {0x319D, 761, 1, Compat}, {0x319E, 762, 1, Compat}, {0x319F, 446, 1, Compat},
+    {0x3200, 763, 3, Compat}, {0x3201, 766, 3, Compat}, {0x3202, 769, 3, Compat},
+    {0x3203, 772, 3, Compat}, {0x3204, 775, 3, Compat}, {0x3205, 778, 3, Compat},
+    {0x3206, 781, 3, Compat}, {0x3207, 784, 3, Compat}, {0x3208, 787, 3, Compat},
+    {0x3209, 790, 3, Compat}, {0x320A, 793, 3, Compat}, {0x320B, 796, 3, Compat},
+    {0x320C, 799, 3, Compat}, {0x320D, 802, 3, Compat}, {0x320E, 805, 3, Compat},
+    {0x320F, 808, 3, Compat}, {0x3210, 811, 3, Compat}, {0x3211, 814, 3, Compat},
+    {0x3212, 817, 3, Compat}, {0x3213, 820, 3, Compat}, {0x3214, 823, 3, Compat},
+    {0x3215, 826, 3, Compat}, {0x3216, 829, 3, Compat}, {0x3217, 832, 3, Compat},
+    {0x3218, 835, 3, Compat}, {0x3219, 838, 3, Compat}, {0x321A, 841, 3, Compat},
+    {0x321B, 844, 3, Compat}, {0x321C, 847, 3, Compat}, {0x321D, 850, 4, Compat},
+    {0x321E, 854, 4, Compat}, {0x3220, 858, 3, Compat}, {0x3221, 861, 3, Compat},
+    {0x3222, 864, 3, Compat}, {0x3223, 867, 3, Compat}, {0x3224, 870, 3, Compat},
+    {0x3225, 873, 3, Compat}, {0x3226, 876, 3, Compat}, {0x3227, 879, 3, Compat},
+    {0x3228, 882, 3, Compat}, {0x3229, 885, 3, Compat}, {0x322A, 888, 3, Compat},
+    {0x322B, 891, 3, Compat}, {0x322C, 894, 3, Compat}, {0x322D, 897, 3, Compat},
+    {0x322E, 900, 3, Compat}, {0x322F, 903, 3, Compat}, {0x3230, 906, 3, Compat},
+    {0x3231, 909, 3, Compat}, {0x3232, 912, 3, Compat}, {0x3233, 915, 3, Compat},
+    {0x3234, 918, 3, Compat}, {0x3235, 921, 3, Compat}, {0x3236, 924, 3, Compat},
+    {0x3237, 927, 3, Compat}, {0x3238, 930, 3, Compat}, {0x3239, 933, 3, Compat},
+    {0x323A, 936, 3, Compat}, {0x323B, 939, 3, Compat}, {0x323C, 942, 3, Compat},
+    {0x323D, 945, 3, Compat}, {0x323E, 948, 3, Compat}, {0x323F, 951, 3, Compat},
+    {0x3240, 954, 3, Compat}, {0x3241, 957, 3, Compat}, {0x3242, 960, 3, Compat},
+    {0x3243, 963, 3, Compat}, {0x3244, 966, 1, Compat}, {0x3245, 967, 1, Compat},
+    {0x3246, 504, 1, Compat}, {0x3247, 968, 1, Compat}, {0x3250, 969, 3, Compat},
+    {0x3251, 213, 2, Compat}, {0x3252, 972, 2, Compat}, {0x3253, 2, 2, Compat},
+    {0x3254, 974, 2, Compat}, {0x3255, 976, 2, Compat}, {0x3256, 978, 2, Compat},
+    {0x3257, 980, 2, Compat}, {0x3258, 982, 2, Compat}, {0x3259, 984, 2, Compat},
+    {0x325A, 986, 2, Compat}, {0x325B, 130, 2, Compat}, {0x325C, 127, 2, Compat},
+    {0x325D, 988, 2, Compat}, {0x325E, 990, 2, Compat}, {0x325F, 992, 2, Compat},
+    {0x3260, 659, 1, Compat}, {0x3261, 662, 1, Compat}, {0x3262, 665, 1, Compat},
+    {0x3263, 667, 1, Compat}, {0x3264, 675, 1, Compat}, {0x3265, 676, 1, Compat},
+    {0x3266, 679, 1, Compat}, {0x3267, 681, 1, Compat}, {0x3268, 682, 1, Compat},
+    {0x3269, 684, 1, Compat}, {0x326A, 685, 1, Compat}, {0x326B, 686, 1, Compat},
+    {0x326C, 687, 1, Compat}, {0x326D, 688, 1, Compat}, {0x326E, 806, 1, Compat},
+    {0x326F, 809, 1, Compat}, {0x3270, 812, 1, Compat}, {0x3271, 815, 1, Compat},
+    {0x3272, 818, 1, Compat}, {0x3273, 821, 1, Compat}, {0x3274, 824, 1, Compat},
+    {0x3275, 827, 1, Compat}, {0x3276, 830, 1, Compat}, {0x3277, 833, 1, Compat},
+    {0x3278, 836, 1, Compat}, {0x3279, 839, 1, Compat}, {0x327A, 842, 1, Compat},
+    {0x327B, 845, 1, Compat}, {0x327C, 994, 2, Compat}, {0x327D, 996, 2, Compat},
+    {0x327E, 998, 1, Compat}, {0x3280, 438, 1, Compat}, {0x3281, 444, 1, Compat},
+    {0x3282, 753, 1, Compat}, {0x3283, 754, 1, Compat}, {0x3284, 871, 1, Compat},
+    {0x3285, 874, 1, Compat}, {0x3286, 877, 1, Compat}, {0x3287, 449, 1, Compat},
+    {0x3288, 883, 1, Compat}, {0x3289, 461, 1, Compat}, {0x328A, 511, 1, Compat},
+    {0x328B, 523, 1, Compat}, {0x328C, 522, 1, Compat}, {0x328D, 512, 1, Compat},
+    {0x328E, 604, 1, Compat}, {0x328F, 469, 1, Compat}, {0x3290, 509, 1, Compat},
+    {0x3291, 910, 1, Compat}, {0x3292, 913, 1, Compat}, {0x3293, 916, 1, Compat},
+    {0x3294, 919, 1, Compat}, {0x3295, 922, 1, Compat}, {0x3296, 925, 1, Compat},
+    {0x3297, 928, 1, Compat}, {0x3298, 931, 1, Compat}, {0x3299, 999, 1, Compat},
+    {0x329A, 1000, 1, Compat}, {0x329B, 475, 1, Compat}, {0x329C, 1001, 1, Compat},
+    {0x329D, 1002, 1, Compat}, {0x329E, 1003, 1, Compat}, {0x329F, 1004, 1, Compat},
+    {0x32A0, 1005, 1, Compat}, {0x32A1, 958, 1, Compat}, {0x32A2, 1006, 1, Compat},
+    {0x32A3, 1007, 1, Compat}, {0x32A4, 755, 1, Compat}, {0x32A5, 756, 1, Compat},
+    {0x32A6, 757, 1, Compat}, {0x32A7, 1008, 1, Compat}, {0x32A8, 1009, 1, Compat},
+    {0x32A9, 1010, 1, Compat}, {0x32AA, 1011, 1, Compat}, {0x32AB, 940, 1, Compat},
+    {0x32AC, 943, 1, Compat}, {0x32AD, 946, 1, Compat}, {0x32AE, 949, 1, Compat},
+    {0x32AF, 952, 1, Compat}, {0x32B0, 1012, 1, Compat}, {0x32B1, 1013, 2, Compat},
+    {0x32B2, 1015, 2, Compat}, {0x32B3, 1017, 2, Compat}, {0x32B4, 1019, 2, Compat},
+    {0x32B5, 1021, 2, Compat}, {0x32B6, 9, 2, Compat}, {0x32B7, 975, 2, Compat},
+    {0x32B8, 991, 2, Compat}, {0x32B9, 1023, 2, Compat}, {0x32BA, 1025, 2, Compat},
+    {0x32BB, 1027, 2, Compat}, {0x32BC, 1029, 2, Compat}, {0x32BD, 1031, 2, Compat},
+    {0x32BE, 1033, 2, Compat}, {0x32BF, 1035, 2, Compat}, {0x32C0, 1037, 2, Compat},
+    {0x32C1, 1039, 2, Compat}, {0x32C2, 1041, 2, Compat}, {0x32C3, 1043, 2, Compat},
+    {0x32C4, 1045, 2, Compat}, {0x32C5, 1047, 2, Compat}, {0x32C6, 1049, 2, Compat},
+    {0x32C7, 1051, 2, Compat}, {0x32C8, 1053, 2, Compat}, {0x32C9, 1055, 3, Compat},
+    {0x32CA, 1058, 3, Compat}, {0x32CB, 1061, 3, Compat}, {0x32CC, 1064, 2, Compat},
+    {0x32CD, 1066, 3, Compat}, {0x32CE, 1069, 2, Compat}, {0x32CF, 1071, 3, Compat},
+    {0x32D0, 1074, 1, Compat}, {0x32D1, 1075, 1, Compat}, {0x32D2, 1076, 1, Compat},
+    {0x32D3, 1077, 1, Compat}, {0x32D4, 1078, 1, Compat}, {0x32D5, 1079, 1, Compat},
+    {0x32D6, 1080, 1, Compat}, {0x32D7, 1081, 1, Compat}, {0x32D8, 1082, 1, Compat},
+    {0x32D9, 657, 1, Compat}, {0x32DA, 1083, 1, Compat}, {0x32DB, 1084, 1, Compat},
+    {0x32DC, 1085, 1, Compat}, {0x32DD, 1086, 1, Compat}, {0x32DE, 1087, 1, Compat},
+    {0x32DF, 1088, 1, Compat}, {0x32E0, 1089, 1, Compat}, {0x32E1, 1090, 1, Compat},
+    {0x32E2, 1091, 1, Compat}, {0x32E3, 658, 1, Compat}, {0x32E4, 1092, 1, Compat},
+    {0x32E5, 1093, 1, Compat}, {0x32E6, 1094, 1, Compat}, {0x32E7, 1095, 1, Compat},
+    {0x32E8, 1096, 1, Compat}, {0x32E9, 1097, 1, Compat}, {0x32EA, 1098, 1, Compat},
+    {0x32EB, 1099, 1, Compat}, {0x32EC, 1100, 1, Compat}, {0x32ED, 1101, 1, Compat},
+    {0x32EE, 1102, 1, Compat}, {0x32EF, 1103, 1, Compat}, {0x32F0, 1104, 1, Compat},
+    {0x32F1, 1105, 1, Compat}, {0x32F2, 1106, 1, Compat}, {0x32F3, 1107, 1, Compat},
+    {0x32F4, 1108, 1, Compat}, {0x32F5, 1109, 1, Compat}, {0x32F6, 1110, 1, Compat},
+    {0x32F7, 1111, 1, Compat}, {0x32F8, 1112, 1, Compat}, {0x32F9, 1113, 1, Compat},
+    {0x32FA, 1114, 1, Compat}, {0x32FB, 1115, 1, Compat}, {0x32FC, 1116, 1, Compat},
+    {0x32FD, 1117, 1, Compat}, {0x32FE, 1118, 1, Compat}, {0x32FF, 1119, 2, Compat},
+    {0x3300, 1121, 4, Compat}, {0x3301, 1125, 4, Compat}, {0x3302, 1129, 4, Compat},
+    {0x3303, 1133, 3, Compat}, {0x3304, 1136, 4, Compat}, {0x3305, 1140, 3, Compat},
+    {0x3306, 1143, 3, Compat}, {0x3307, 1146, 5, Compat}, {0x3308, 1151, 4, Compat},
+    {0x3309, 1155, 3, Compat}, {0x330A, 1158, 3, Compat}, {0x330B, 1161, 3, Compat},
+    {0x330C, 1164, 4, Compat}, {0x330D, 1168, 4, Compat}, {0x330E, 1172, 3, Compat},
+    {0x330F, 1175, 3, Compat}, {0x3310, 1178, 2, Compat}, {0x3311, 1180, 3, Compat},
+    {0x3312, 1183, 4, Compat}, {0x3313, 1187, 4, Compat}, {0x3314, 1191, 2, Compat},
+    {0x3315, 1193, 5, Compat}, {0x3316, 1198, 6, Compat}, {0x3317, 1204, 5, Compat},
+    {0x3318, 1195, 3, Compat}, {0x3319, 1209, 5, Compat}, {0x331A, 1214, 5, Compat},
+    {0x331B, 1219, 4, Compat}, {0x331C, 1223, 3, Compat}, {0x331D, 1226, 3, Compat},
+    {0x331E, 1229, 3, Compat}, {0x331F, 1232, 4, Compat}, {0x3320, 1236, 5, Compat},
+    {0x3321, 1241, 4, Compat}, {0x3322, 1245, 3, Compat}, {0x3323, 1248, 3, Compat},
+    {0x3324, 1251, 3, Compat}, {0x3325, 1254, 2, Compat}, {0x3326, 1256, 2, Compat},
+    {0x3327, 1212, 2, Compat}, {0x3328, 1258, 2, Compat}, {0x3329, 1260, 3, Compat},
+    {0x332A, 1263, 3, Compat}, {0x332B, 1266, 5, Compat}, {0x332C, 1271, 3, Compat},
+    {0x332D, 1274, 4, Compat}, {0x332E, 1278, 5, Compat}, {0x332F, 1283, 3, Compat},
+    {0x3330, 1286, 2, Compat}, {0x3331, 1288, 2, Compat}, {0x3332, 1290, 5, Compat},
+    {0x3333, 1295, 4, Compat}, {0x3334, 1299, 5, Compat}, {0x3335, 1304, 3, Compat},
+    {0x3336, 1307, 5, Compat}, {0x3337, 1312, 2, Compat}, {0x3338, 1314, 3, Compat},
+    {0x3339, 1317, 3, Compat}, {0x333A, 1320, 3, Compat}, {0x333B, 1323, 3, Compat},
+    {0x333C, 1326, 3, Compat}, {0x333D, 1329, 4, Compat}, {0x333E, 1333, 3, Compat},
+    {0x333F, 1336, 2, Compat}, {0x3340, 1338, 3, Compat}, {0x3341, 1341, 3, Compat},
+    {0x3342, 1344, 3, Compat}, {0x3343, 1347, 4, Compat}, {0x3344, 1351, 3, Compat},
+    {0x3345, 1354, 3, Compat}, {0x3346, 1357, 3, Compat}, {0x3347, 1360, 5, Compat},
+    {0x3348, 1365, 4, Compat}, {0x3349, 1369, 2, Compat}, {0x334A, 1371, 5, Compat},
+    {0x334B, 1376, 2, Compat}, {0x334C, 1378, 4, Compat}, {0x334D, 1200, 4, Compat},
+    {0x334E, 1382, 3, Compat}, {0x334F, 1385, 3, Compat}, {0x3350, 1388, 3, Compat},
+    {0x3351, 1391, 4, Compat}, {0x3352, 1395, 2, Compat}, {0x3353, 1397, 3, Compat},
+    {0x3354, 1400, 4, Compat}, {0x3355, 1404, 2, Compat}, {0x3356, 1406, 5, Compat},
+    {0x3357, 1206, 3, Compat}, {0x3358, 1411, 2, Compat}, {0x3359, 1413, 2, Compat},
+    {0x335A, 1415, 2, Compat}, {0x335B, 1417, 2, Compat}, {0x335C, 1419, 2, Compat},
+    {0x335D, 1421, 2, Compat}, {0x335E, 1423, 2, Compat}, {0x335F, 1425, 2, Compat},
+    {0x3360, 1427, 2, Compat}, {0x3361, 1429, 2, Compat}, {0x3362, 1431, 3, Compat},
+    {0x3363, 1434, 3, Compat}, {0x3364, 1437, 3, Compat}, {0x3365, 1440, 3, Compat},
+    {0x3366, 1443, 3, Compat}, {0x3367, 1446, 3, Compat}, {0x3368, 1449, 3, Compat},
+    {0x3369, 1452, 3, Compat}, {0x336A, 1455, 3, Compat}, {0x336B, 1458, 3, Compat},
+    {0x336C, 1461, 3, Compat}, {0x336D, 1464, 3, Compat}, {0x336E, 1467, 3, Compat},
+    {0x336F, 1470, 3, Compat}, {0x3370, 1473, 3, Compat}, {0x3371, 1476, 3, Compat},
+    {0x3372, 1479, 2, Compat}, {0x3373, 1481, 2, Compat}, {0x3374, 1483, 3, Compat},
+    {0x3375, 1486, 2, Compat}, {0x3376, 1488, 2, Compat}, {0x3377, 1490, 2, Compat},
+    {0x3378, 1492, 3, Compat}, {0x3379, 1495, 3, Compat}, {0x337A, 1498, 2, Compat},
+    {0x337B, 1500, 2, Compat}, {0x337C, 1502, 2, Compat}, {0x337D, 1504, 2, Compat},
+    {0x337E, 1506, 2, Compat}, {0x337F, 1508, 4, Compat}, {0x3380, 1512, 2, Compat},
+    {0x3381, 1514, 2, Compat}, {0x3382, 1516, 2, Compat}, {0x3383, 1518, 2, Compat},
+    {0x3384, 1520, 2, Compat}, {0x3385, 1522, 2, Compat}, {0x3386, 1524, 2, Compat},
+    {0x3387, 1526, 2, Compat}, {0x3388, 1528, 3, Compat}, {0x3389, 1531, 4, Compat},
+    {0x338A, 1535, 2, Compat}, {0x338B, 1537, 2, Compat}, {0x338C, 1539, 2, Compat},
+    {0x338D, 1541, 2, Compat}, {0x338E, 1543, 2, Compat}, {0x338F, 1545, 2, Compat},
+    {0x3390, 1547, 2, Compat}, {0x3391, 1549, 3, Compat}, {0x3392, 1552, 3, Compat},
+    {0x3393, 1555, 3, Compat}, {0x3394, 1558, 3, Compat}, {0x3395, 1561, 2, Compat},
+    {0x3396, 1563, 2, Compat}, {0x3397, 1565, 2, Compat}, {0x3398, 53, 2, Compat},
+    {0x3399, 1567, 2, Compat}, {0x339A, 1569, 2, Compat}, {0x339B, 1571, 2, Compat},
+    {0x339C, 1573, 2, Compat}, {0x339D, 1575, 2, Compat}, {0x339E, 1577, 2, Compat},
+    {0x339F, 1579, 3, Compat}, {0x33A0, 1582, 3, Compat}, {0x33A1, 1493, 2, Compat},
+    {0x33A2, 1585, 3, Compat}, {0x33A3, 1588, 3, Compat}, {0x33A4, 1591, 3, Compat},
+    {0x33A5, 1496, 2, Compat}, {0x33A6, 1594, 3, Compat}, {0x33A7, 1597, 3, Compat},
+    {0x33A8, 1600, 4, Compat}, {0x33A9, 1477, 2, Compat}, {0x33AA, 1604, 3, Compat},
+    {0x33AB, 1607, 3, Compat}, {0x33AC, 1610, 3, Compat}, {0x33AD, 1613, 3, Compat},
+    {0x33AE, 1616, 5, Compat}, {0x33AF, 1621, 6, Compat}, {0x33B0, 56, 2, Compat},
+    {0x33B1, 1627, 2, Compat}, {0x33B2, 1629, 2, Compat}, {0x33B3, 1631, 2, Compat},
+    {0x33B4, 1633, 2, Compat}, {0x33B5, 1635, 2, Compat}, {0x33B6, 1637, 2, Compat},
+    {0x33B7, 1639, 2, Compat}, {0x33B8, 1641, 2, Compat}, {0x33B9, 1643, 2, Compat},
+    {0x33BA, 1645, 2, Compat}, {0x33BB, 1647, 2, Compat}, {0x33BC, 1649, 2, Compat},
+    {0x33BD, 1651, 2, Compat}, {0x33BE, 1653, 2, Compat}, {0x33BF, 1655, 2, Compat},
+    {0x33C0, 1657, 2, Compat}, {0x33C1, 1659, 2, Compat}, {0x33C2, 1661, 4, Compat},
+    {0x33C3, 1665, 2, Compat}, {0x33C4, 1667, 2, Compat}, {0x33C5, 1489, 2, Compat},
+    {0x33C6, 1669, 4, Compat}, {0x33C7, 1673, 3, Compat}, {0x33C8, 1676, 2, Compat},
+    {0x33C9, 1678, 2, Compat}, {0x33CA, 1680, 2, Compat}, {0x33CB, 1682, 2, Compat},
+    {0x33CC, 1684, 2, Compat}, {0x33CD, 1686, 2, Compat}, {0x33CE, 1688, 2, Compat},
+    {0x33CF, 1690, 2, Compat}, {0x33D0, 54, 2, Compat}, {0x33D1, 1692, 2, Compat},
+    {0x33D2, 1694, 3, Compat}, {0x33D3, 1697, 2, Compat}, {0x33D4, 1699, 2, Compat},
+    {0x33D5, 1701, 3, Compat}, {0x33D6, 1704, 3, Compat}, {0x33D7, 1707, 2, Compat},
+    {0x33D8, 1709, 4, Compat}, {0x33D9, 1713, 3, Compat}, {0x33DA, 1716, 2, Compat},
+    {0x33DB, 1620, 2, Compat}, {0x33DC, 1718, 2, Compat}, {0x33DD, 1720, 2, Compat},
+    {0x33DE, 1722, 3, Compat}, {0x33DF, 1725, 3, Compat}, {0x33E0, 1728, 2, Compat},
+    {0x33E1, 1730, 2, Compat}, {0x33E2, 1732, 2, Compat}, {0x33E3, 1734, 2, Compat},
+    {0x33E4, 1736, 2, Compat}, {0x33E5, 1738, 2, Compat}, {0x33E6, 1740, 2, Compat},
+    {0x33E7, 1742, 2, Compat}, {0x33E8, 1744, 2, Compat}, {0x33E9, 1746, 3, Compat},
+    {0x33EA, 1749, 3, Compat}, {0x33EB, 1752, 3, Compat}, {0x33EC, 1755, 3, Compat},
+    {0x33ED, 1758, 3, Compat}, {0x33EE, 1761, 3, Compat}, {0x33EF, 1764, 3, Compat},
+    {0x33F0, 1767, 3, Compat}, {0x33F1, 1770, 3, Compat}, {0x33F2, 1773, 3, Compat},
+    {0x33F3, 1776, 3, Compat}, {0x33F4, 1779, 3, Compat}, {0x33F5, 1782, 3, Compat},
+    {0x33F6, 1785, 3, Compat}, {0x33F7, 1788, 3, Compat}, {0x33F8, 1791, 3, Compat},
+    {0x33F9, 1794, 3, Compat}, {0x33FA, 1797, 3, Compat}, {0x33FB, 1800, 3, Compat},
+    {0x33FC, 1803, 3, Compat}, {0x33FD, 1806, 3, Compat}, {0x33FE, 1809, 3, Compat},
+    {0x33FF, 1812, 3, Compat}, {0xF900, 1815, 1, Compat}, {0xF901, 1816, 1, Compat},
+    {0xF902, 596, 1, Compat}, {0xF903, 1817, 1, Compat}, {0xF904, 1818, 1, Compat},
+    {0xF905, 1819, 1, Compat}, {0xF906, 1820, 1, Compat}, {0xF907, 650, 1, Compat},
+    {0xF908, 650, 1, Compat}, {0xF909, 1821, 1, Compat}, {0xF90A, 604, 1, Compat},
+    {0xF90B, 1822, 1, Compat}, {0xF90C, 1823, 1, Compat}, {0xF90D, 1824, 1, Compat},
+    {0xF90E, 1825, 1, Compat}, {0xF90F, 1826, 1, Compat}, {0xF910, 1827, 1, Compat},
+    {0xF911, 1828, 1, Compat}, {0xF912, 1829, 1, Compat}, {0xF913, 1830, 1, Compat},
+    {0xF914, 1831, 1, Compat}, {0xF915, 1832, 1, Compat}, {0xF916, 1833, 1, Compat},
+    {0xF917, 1834, 1, Compat}, {0xF918, 1835, 1, Compat}, {0xF919, 1836, 1, Compat},
+    {0xF91A, 1837, 1, Compat}, {0xF91B, 1838, 1, Compat}, {0xF91C, 1839, 1, Compat},
+    {0xF91D, 1840, 1, Compat}, {0xF91E, 1841, 1, Compat}, {0xF91F, 1842, 1, Compat},
+    {0xF920, 1843, 1, Compat}, {0xF921, 1844, 1, Compat}, {0xF922, 1845, 1, Compat},
+    {0xF923, 1846, 1, Compat}, {0xF924, 1847, 1, Compat}, {0xF925, 1848, 1, Compat},
+    {0xF926, 1849, 1, Compat}, {0xF927, 1850, 1, Compat}, {0xF928, 1851, 1, Compat},
+    {0xF929, 1852, 1, Compat}, {0xF92A, 1853, 1, Compat}, {0xF92B, 1854, 1, Compat},
+    {0xF92C, 1855, 1, Compat}, {0xF92D, 1856, 1, Compat}, {0xF92E, 1857, 1, Compat},
+    {0xF92F, 1858, 1, Compat}, {0xF930, 1859, 1, Compat}, {0xF931, 1860, 1, Compat},
+    {0xF932, 1861, 1, Compat}, {0xF933, 1862, 1, Compat}, {0xF934, 562, 1, Compat},
+    {0xF935, 1863, 1, Compat}, {0xF936, 1864, 1, Compat}, {0xF937, 1865, 1, Compat},
+    {0xF938, 1866, 1, Compat}, {0xF939, 1867, 1, Compat}, {0xF93A, 1868, 1, Compat},
+    {0xF93B, 1869, 1, Compat}, {0xF93C, 1870, 1, Compat}, {0xF93D, 1871, 1, Compat},
+    {0xF93E, 1872, 1, Compat}, {0xF93F, 1873, 1, Compat}, {0xF940, 635, 1, Compat},
+    {0xF941, 1874, 1, Compat}, {0xF942, 1875, 1, Compat}, {0xF943, 1876, 1, Compat},
+    {0xF944, 1877, 1, Compat}, {0xF945, 1878, 1, Compat}, {0xF946, 1879, 1, Compat},
+    {0xF947, 1880, 1, Compat}, {0xF948, 1881, 1, Compat}, {0xF949, 1882, 1, Compat},
+    {0xF94A, 1883, 1, Compat}, {0xF94B, 1884, 1, Compat}, {0xF94C, 1885, 1, Compat},
+    {0xF94D, 1886, 1, Compat}, {0xF94E, 1887, 1, Compat}, {0xF94F, 1888, 1, Compat},
+    {0xF950, 1889, 1, Compat}, {0xF951, 1890, 1, Compat}, {0xF952, 1891, 1, Compat},
+    {0xF953, 1892, 1, Compat}, {0xF954, 1893, 1, Compat}, {0xF955, 1894, 1, Compat},
+    {0xF956, 1895, 1, Compat}, {0xF957, 1896, 1, Compat}, {0xF958, 1897, 1, Compat},
+    {0xF959, 1898, 1, Compat}, {0xF95A, 1899, 1, Compat}, {0xF95B, 1900, 1, Compat},
+    {0xF95C, 1831, 1, Compat}, {0xF95D, 1901, 1, Compat}, {0xF95E, 1902, 1, Compat},
+    {0xF95F, 1903, 1, Compat}, {0xF960, 1904, 1, Compat}, {0xF961, 1905, 1, Compat},
+    {0xF962, 1906, 1, Compat}, {0xF963, 1907, 1, Compat}, {0xF964, 1908, 1, Compat},
+    {0xF965, 1909, 1, Compat}, {0xF966, 1910, 1, Compat}, {0xF967, 1911, 1, Compat},
+    {0xF968, 1912, 1, Compat}, {0xF969, 1913, 1, Compat}, {0xF96A, 1914, 1, Compat},
+    {0xF96B, 1915, 1, Compat}, {0xF96C, 1916, 1, Compat}, {0xF96D, 1917, 1, Compat},
+    {0xF96E, 1918, 1, Compat}, {0xF96F, 1919, 1, Compat}, {0xF970, 1920, 1, Compat},
+    {0xF971, 598, 1, Compat}, {0xF972, 1921, 1, Compat}, {0xF973, 1922, 1, Compat},
+    {0xF974, 1923, 1, Compat}, {0xF975, 1924, 1, Compat}, {0xF976, 1925, 1, Compat},
+    {0xF977, 1926, 1, Compat}, {0xF978, 1927, 1, Compat}, {0xF979, 1928, 1, Compat},
+    {0xF97A, 1929, 1, Compat}, {0xF97B, 1930, 1, Compat}, {0xF97C, 1931, 1, Compat},
+    {0xF97D, 1932, 1, Compat}, {0xF97E, 1933, 1, Compat}, {0xF97F, 1934, 1, Compat},
+    {0xF980, 1935, 1, Compat}, {0xF981, 475, 1, Compat}, {0xF982, 1936, 1, Compat},
+    {0xF983, 1937, 1, Compat}, {0xF984, 1938, 1, Compat}, {0xF985, 1939, 1, Compat},
+    {0xF986, 1940, 1, Compat}, {0xF987, 1941, 1, Compat}, {0xF988, 1942, 1, Compat},
+    {0xF989, 1943, 1, Compat}, {0xF98A, 456, 1, Compat}, {0xF98B, 1944, 1, Compat},
+    {0xF98C, 1945, 1, Compat}, {0xF98D, 1946, 1, Compat}, {0xF98E, 1947, 1, Compat},
+    {0xF98F, 1948, 1, Compat}, {0xF990, 1949, 1, Compat}, {0xF991, 1950, 1, Compat},
+    {0xF992, 1951, 1, Compat}, {0xF993, 1952, 1, Compat}, {0xF994, 1953, 1, Compat},
+    {0xF995, 1954, 1, Compat}, {0xF996, 1955, 1, Compat}, {0xF997, 1956, 1, Compat},
+    {0xF998, 1957, 1, Compat}, {0xF999, 1958, 1, Compat}, {0xF99A, 1959, 1, Compat},
+    {0xF99B, 1960, 1, Compat}, {0xF99C, 1961, 1, Compat}, {0xF99D, 1962, 1, Compat},
+    {0xF99E, 1963, 1, Compat}, {0xF99F, 1964, 1, Compat}, {0xF9A0, 1965, 1, Compat},
+    {0xF9A1, 1919, 1, Compat}, {0xF9A2, 1966, 1, Compat}, {0xF9A3, 1967, 1, Compat},
+    {0xF9A4, 1968, 1, Compat}, {0xF9A5, 1969, 1, Compat}, {0xF9A6, 1970, 1, Compat},
+    {0xF9A7, 1971, 1, Compat}, {0xF9A8, 1119, 1, Compat}, {0xF9A9, 1972, 1, Compat},
+    {0xF9AA, 1903, 1, Compat}, {0xF9AB, 1973, 1, Compat}, {0xF9AC, 1974, 1, Compat},
+    {0xF9AD, 1975, 1, Compat}, {0xF9AE, 1976, 1, Compat}, {0xF9AF, 1977, 1, Compat},
+    {0xF9B0, 1978, 1, Compat}, {0xF9B1, 1979, 1, Compat}, {0xF9B2, 1980, 1, Compat},
+    {0xF9B3, 1981, 1, Compat}, {0xF9B4, 1982, 1, Compat}, {0xF9B5, 1983, 1, Compat},
+    {0xF9B6, 1984, 1, Compat}, {0xF9B7, 1985, 1, Compat}, {0xF9B8, 1986, 1, Compat},
+    {0xF9B9, 1987, 1, Compat}, {0xF9BA, 1988, 1, Compat}, {0xF9BB, 1989, 1, Compat},
+    {0xF9BC, 1990, 1, Compat}, {0xF9BD, 1991, 1, Compat}, {0xF9BE, 1992, 1, Compat},
+    {0xF9BF, 1831, 1, Compat}, {0xF9C0, 1993, 1, Compat}, {0xF9C1, 1994, 1, Compat},
+    {0xF9C2, 1995, 1, Compat}, {0xF9C3, 1996, 1, Compat}, {0xF9C4, 649, 1, Compat},
+    {0xF9C5, 1997, 1, Compat}, {0xF9C6, 1998, 1, Compat}, {0xF9C7, 1999, 1, Compat},
+    {0xF9C8, 2000, 1, Compat}, {0xF9C9, 2001, 1, Compat}, {0xF9CA, 2002, 1, Compat},
+    {0xF9CB, 2003, 1, Compat}, {0xF9CC, 2004, 1, Compat}, {0xF9CD, 2005, 1, Compat},
+    {0xF9CE, 2006, 1, Compat}, {0xF9CF, 2007, 1, Compat}, {0xF9D0, 2008, 1, Compat},
+    {0xF9D1, 874, 1, Compat}, {0xF9D2, 2009, 1, Compat}, {0xF9D3, 2010, 1, Compat},
+    {0xF9D4, 2011, 1, Compat}, {0xF9D5, 2012, 1, Compat}, {0xF9D6, 2013, 1, Compat},
+    {0xF9D7, 2014, 1, Compat}, {0xF9D8, 2015, 1, Compat}, {0xF9D9, 2016, 1, Compat},
+    {0xF9DA, 2017, 1, Compat}, {0xF9DB, 1905, 1, Compat}, {0xF9DC, 2018, 1, Compat},
+    {0xF9DD, 2019, 1, Compat}, {0xF9DE, 2020, 1, Compat}, {0xF9DF, 2021, 1, Compat},
+    {0xF9E0, 2022, 1, Compat}, {0xF9E1, 2023, 1, Compat}, {0xF9E2, 2024, 1, Compat},
+    {0xF9E3, 2025, 1, Compat}, {0xF9E4, 2026, 1, Compat}, {0xF9E5, 2027, 1, Compat},
+    {0xF9E6, 2028, 1, Compat}, {0xF9E7, 2029, 1, Compat}, {0xF9E8, 2030, 1, Compat},
+    {0xF9E9, 603, 1, Compat}, {0xF9EA, 2031, 1, Compat}, {0xF9EB, 2032, 1, Compat},
+    {0xF9EC, 2033, 1, Compat}, {0xF9ED, 2034, 1, Compat}, {0xF9EE, 2035, 1, Compat},
+    {0xF9EF, 2036, 1, Compat}, {0xF9F0, 2037, 1, Compat}, {0xF9F1, 2038, 1, Compat},
+    {0xF9F2, 2039, 1, Compat}, {0xF9F3, 2040, 1, Compat}, {0xF9F4, 2041, 1, Compat},
+    {0xF9F5, 2042, 1, Compat}, {0xF9F6, 2043, 1, Compat}, {0xF9F7, 554, 1, Compat},
+    {0xF9F8, 2044, 1, Compat}, {0xF9F9, 2045, 1, Compat}, {0xF9FA, 2046, 1, Compat},
+    {0xF9FB, 2047, 1, Compat}, {0xF9FC, 2048, 1, Compat}, {0xF9FD, 2049, 1, Compat},
+    {0xF9FE, 2050, 1, Compat}, {0xF9FF, 2051, 1, Compat}, {0xFA00, 2052, 1, Compat},
+    {0xFA01, 2053, 1, Compat}, {0xFA02, 2054, 1, Compat}, {0xFA03, 2055, 1, Compat},
+    {0xFA04, 2056, 1, Compat}, {0xFA05, 2057, 1, Compat}, {0xFA06, 2058, 1, Compat},
+    {0xFA07, 2059, 1, Compat}, {0xFA08, 581, 1, Compat}, {0xFA09, 2060, 1, Compat},
+    {0xFA0A, 584, 1, Compat}, {0xFA0B, 2061, 1, Compat}, {0xFA0C, 2062, 1, Compat},
+    {0xFA0D, 2063, 1, Compat}, {0xFA10, 2064, 1, Compat}, {0xFA12, 2065, 1, Compat},
+    {0xFA15, 2066, 1, Compat}, {0xFA16, 2067, 1, Compat}, {0xFA17, 2068, 1, Compat},
+    {0xFA18, 2069, 1, Compat}, {0xFA19, 2070, 1, Compat}, {0xFA1A, 2071, 1, Compat},
+    {0xFA1B, 2072, 1, Compat}, {0xFA1C, 2073, 1, Compat}, {0xFA1D, 2074, 1, Compat},
+    {0xFA1E, 561, 1, Compat}, {0xFA20, 2075, 1, Compat}, {0xFA22, 2076, 1, Compat},
+    {0xFA25, 2077, 1, Compat}, {0xFA26, 2078, 1, Compat}, {0xFA2A, 2079, 1, Compat},
+    {0xFA2B, 2080, 1, Compat}, {0xFA2C, 2081, 1, Compat}, {0xFA2D, 2082, 1, Compat},
+    {0xFA2E, 2083, 1, Compat}, {0xFA2F, 2084, 1, Compat}, {0xFA30, 2085, 1, Compat},
+    {0xFA31, 2086, 1, Compat}, {0xFA32, 2087, 1, Compat}, {0xFA33, 2088, 1, Compat},
+    {0xFA34, 2089, 1, Compat}, {0xFA35, 2090, 1, Compat}, {0xFA36, 2091, 1, Compat},
+    {0xFA37, 2092, 1, Compat}, {0xFA38, 2093, 1, Compat}, {0xFA39, 2094, 1, Compat},
+    {0xFA3A, 2095, 1, Compat}, {0xFA3B, 2096, 1, Compat}, {0xFA3C, 482, 1, Compat},
+    {0xFA3D, 2097, 1, Compat}, {0xFA3E, 2098, 1, Compat}, {0xFA3F, 2099, 1, Compat},
+    {0xFA40, 2100, 1, Compat}, {0xFA41, 2101, 1, Compat}, {0xFA42, 2102, 1, Compat},
+    {0xFA43, 2103, 1, Compat}, {0xFA44, 2104, 1, Compat}, {0xFA45, 2105, 1, Compat},
+    {0xFA46, 2106, 1, Compat}, {0xFA47, 2107, 1, Compat}, {0xFA48, 2108, 1, Compat},
+    {0xFA49, 2109, 1, Compat}, {0xFA4A, 2110, 1, Compat}, {0xFA4B, 2111, 1, Compat},
+    {0xFA4C, 916, 1, Compat}, {0xFA4D, 2112, 1, Compat}, {0xFA4E, 2113, 1, Compat},
+    {0xFA4F, 2114, 1, Compat}, {0xFA50, 2115, 1, Compat}, {0xFA51, 928, 1, Compat},
+    {0xFA52, 2116, 1, Compat}, {0xFA53, 2117, 1, Compat}, {0xFA54, 2118, 1, Compat},
+    {0xFA55, 2119, 1, Compat}, {0xFA56, 2120, 1, Compat}, {0xFA57, 1955, 1, Compat},
+    {0xFA58, 2121, 1, Compat}, {0xFA59, 2122, 1, Compat}, {0xFA5A, 2123, 1, Compat},
+    {0xFA5B, 2124, 1, Compat}, {0xFA5C, 2125, 1, Compat}, {0xFA5D, 2126, 1, Compat},
+    {0xFA5E, 2126, 1, Compat}, {0xFA5F, 2127, 1, Compat}, {0xFA60, 2128, 1, Compat},
+    {0xFA61, 2129, 1, Compat}, {0xFA62, 2130, 1, Compat}, {0xFA63, 2131, 1, Compat},
+    {0xFA64, 2132, 1, Compat}, {0xFA65, 2133, 1, Compat}, {0xFA66, 2134, 1, Compat},
+    {0xFA67, 2077, 1, Compat}, {0xFA68, 2135, 1, Compat}, {0xFA69, 2136, 1, Compat},
+    {0xFA6A, 2137, 1, Compat}, {0xFA6B, 2138, 1, Compat}, {0xFA6C, 2139, 1, Compat},
+    {0xFA6D, 2140, 1, Compat}, {0xFA70, 2141, 1, Compat}, {0xFA71, 2142, 1, Compat},
+    {0xFA72, 2143, 1, Compat}, {0xFA73, 2144, 1, Compat}, {0xFA74, 2145, 1, Compat},
+    {0xFA75, 2146, 1, Compat}, {0xFA76, 2147, 1, Compat}, {0xFA77, 2148, 1, Compat},
+    {0xFA78, 2091, 1, Compat}, {0xFA79, 2149, 1, Compat}, {0xFA7A, 2150, 1, Compat},
+    {0xFA7B, 2151, 1, Compat}, {0xFA7C, 2064, 1, Compat}, {0xFA7D, 2152, 1, Compat},
+    {0xFA7E, 2153, 1, Compat}, {0xFA7F, 2154, 1, Compat}, {0xFA80, 2155, 1, Compat},
+    {0xFA81, 2156, 1, Compat}, {0xFA82, 2157, 1, Compat}, {0xFA83, 2158, 1, Compat},
+    {0xFA84, 2159, 1, Compat}, {0xFA85, 2160, 1, Compat}, {0xFA86, 2161, 1, Compat},
+    {0xFA87, 2162, 1, Compat}, {0xFA88, 2163, 1, Compat}, {0xFA89, 2099, 1, Compat},
+    {0xFA8A, 2164, 1, Compat}, {0xFA8B, 2100, 1, Compat}, {0xFA8C, 2165, 1, Compat},
+    {0xFA8D, 2166, 1, Compat}, {0xFA8E, 2167, 1, Compat}, {0xFA8F, 2168, 1, Compat},
+    {0xFA90, 2169, 1, Compat}, {0xFA91, 2065, 1, Compat}, {0xFA92, 1852, 1, Compat},
+    {0xFA93, 2170, 1, Compat}, {0xFA94, 2171, 1, Compat}, {0xFA95, 515, 1, Compat},
+    {0xFA96, 1920, 1, Compat}, {0xFA97, 2002, 1, Compat}, {0xFA98, 2172, 1, Compat},
+    {0xFA99, 2173, 1, Compat}, {0xFA9A, 2107, 1, Compat}, {0xFA9B, 2174, 1, Compat},
+    {0xFA9C, 2108, 1, Compat}, {0xFA9D, 2175, 1, Compat}, {0xFA9E, 2176, 1, Compat},
+    {0xFA9F, 2177, 1, Compat}, {0xFAA0, 2067, 1, Compat}, {0xFAA1, 2178, 1, Compat},
+    {0xFAA2, 2179, 1, Compat}, {0xFAA3, 2180, 1, Compat}, {0xFAA4, 2181, 1, Compat},
+    {0xFAA5, 2182, 1, Compat}, {0xFAA6, 2068, 1, Compat}, {0xFAA7, 2183, 1, Compat},
+    {0xFAA8, 2184, 1, Compat}, {0xFAA9, 2185, 1, Compat}, {0xFAAA, 2186, 1, Compat},
+    {0xFAAB, 2187, 1, Compat}, {0xFAAC, 2188, 1, Compat}, {0xFAAD, 2120, 1, Compat},
+    {0xFAAE, 2189, 1, Compat}, {0xFAAF, 2190, 1, Compat}, {0xFAB0, 1955, 1, Compat},
+    {0xFAB1, 2191, 1, Compat}, {0xFAB2, 2124, 1, Compat}, {0xFAB3, 2192, 1, Compat},
+    {0xFAB4, 2193, 1, Compat}, {0xFAB5, 2194, 1, Compat}, {0xFAB6, 2195, 1, Compat},
+    {0xFAB7, 2196, 1, Compat}, {0xFAB8, 2129, 1, Compat}, {0xFAB9, 2197, 1, Compat},
+    {0xFABA, 2076, 1, Compat}, {0xFABB, 2198, 1, Compat}, {0xFABC, 2130, 1, Compat},
+    {0xFABD, 1901, 1, Compat}, {0xFABE, 2199, 1, Compat}, {0xFABF, 2131, 1, Compat},
+    {0xFAC0, 2200, 1, Compat}, {0xFAC1, 2133, 1, Compat}, {0xFAC2, 2201, 1, Compat},
+    {0xFAC3, 2202, 1, Compat}, {0xFAC4, 2203, 1, Compat}, {0xFAC5, 2204, 1, Compat},
+    {0xFAC6, 2205, 1, Compat}, {0xFAC7, 2135, 1, Compat}, {0xFAC8, 2073, 1, Compat},
+    {0xFAC9, 2206, 1, Compat}, {0xFACA, 2136, 1, Compat}, {0xFACB, 2207, 1, Compat},
+    {0xFACC, 2137, 1, Compat}, {0xFACD, 2208, 1, Compat}, {0xFACE, 650, 1, Compat},
+    {0xFACF, 2209, 1, Compat}, {0xFAD0, 2210, 1, Compat}, {0xFAD1, 2211, 1, Compat},
+    {0xFAD2, 2212, 1, Compat}, {0xFAD3, 2213, 1, Compat}, {0xFAD4, 2214, 1, Compat},
+    {0xFAD5, 2215, 1, Compat}, {0xFAD6, 2216, 1, Compat}, {0xFAD7, 2217, 1, Compat},
+    {0xFAD8, 2218, 1, Compat}, {0xFAD9, 2219, 1, Compat}, {0xFE30, 17, 2, Compat},
+    {0xFE31, 2220, 1, Compat}, {0xFE32, 2221, 1, Compat}, {0xFE33, 2222, 1, Compat},
+    {0xFE34, 2222, 1, Compat}, {0xFE35, 46, 1, Compat}, {0xFE36, 47, 1, Compat},
+    {0xFE37, 2223, 1, Compat}, {0xFE38, 2224, 1, Compat}, {0xFE39, 2225, 1, Compat},
+    {0xFE3A, 2226, 1, Compat}, {0xFE3B, 2227, 1, Compat}, {0xFE3C, 2228, 1, Compat},
+    {0xFE3D, 2229, 1, Compat}, {0xFE3E, 2230, 1, Compat}, {0xFE3F, 2231, 1, Compat},
+    {0xFE40, 2232, 1, Compat}, {0xFE41, 2233, 1, Compat}, {0xFE42, 2234, 1, Compat},
+    {0xFE43, 2235, 1, Compat}, {0xFE44, 2236, 1, Compat}, {0xFE47, 2237, 1, Compat},
+    {0xFE48, 2238, 1, Compat}, {0xFE4D, 2222, 1, Compat}, {0xFE4E, 2222, 1, Compat},
+    {0xFE4F, 2222, 1, Compat}, {0xFF01, 30, 1, Alnum}, {0xFF02, 2239, 1, Alnum},
+    {0xFF03, 2240, 1, Alnum}, {0xFF04, 2241, 1, Alnum}, {0xFF05, 2242, 1, Alnum},
+    {0xFF06, 2243, 1, Alnum}, {0xFF07, 2244, 1, Alnum}, {0xFF08, 46, 1, Alnum},
+    {0xFF09, 47, 1, Alnum}, {0xFF0A, 2245, 1, Alnum}, {0xFF0B, 43, 1, Alnum},
+    {0xFF0C, 2246, 1, Alnum}, {0xFF0D, 2247, 1, Alnum}, {0xFF0E, 17, 1, Alnum},
+    {0xFF0F, 60, 1, Alnum}, {0xFF10, 36, 1, Alnum}, {0xFF11, 5, 1, Alnum}, {0xFF12, 2, 1, Alnum},
+    {0xFF13, 3, 1, Alnum}, {0xFF14, 9, 1, Alnum}, {0xFF15, 38, 1, Alnum}, {0xFF16, 39, 1, Alnum},
+    {0xFF17, 40, 1, Alnum}, {0xFF18, 41, 1, Alnum}, {0xFF19, 42, 1, Alnum},
+    {0xFF1A, 2248, 1, Alnum}, {0xFF1B, 2249, 1, Alnum}, {0xFF1C, 2250, 1, Alnum},
+    {0xFF1D, 45, 1, Alnum}, {0xFF1E, 2251, 1, Alnum}, {0xFF1F, 32, 1, Alnum},
+    {0xFF20, 2252, 1, Alnum}, {0xFF21, 105, 1, Alnum}, {0xFF22, 99, 1, Alnum},
+    {0xFF23, 65, 1, Alnum}, {0xFF24, 112, 1, Alnum}, {0xFF25, 91, 1, Alnum}, {0xFF26, 76, 1, Alnum},
+    {0xFF27, 430, 1, Alnum}, {0xFF28, 78, 1, Alnum}, {0xFF29, 80, 1, Alnum},
+    {0xFF2A, 431, 1, Alnum}, {0xFF2B, 97, 1, Alnum}, {0xFF2C, 81, 1, Alnum}, {0xFF2D, 89, 1, Alnum},
+    {0xFF2E, 82, 1, Alnum}, {0xFF2F, 432, 1, Alnum}, {0xFF30, 85, 1, Alnum}, {0xFF31, 86, 1, Alnum},
+    {0xFF32, 87, 1, Alnum}, {0xFF33, 88, 1, Alnum}, {0xFF34, 90, 1, Alnum}, {0xFF35, 433, 1, Alnum},
+    {0xFF36, 167, 1, Alnum}, {0xFF37, 434, 1, Alnum}, {0xFF38, 106, 1, Alnum},
+    {0xFF39, 435, 1, Alnum}, {0xFF3A, 95, 1, Alnum}, {0xFF3B, 2237, 1, Alnum},
+    {0xFF3C, 2253, 1, Alnum}, {0xFF3D, 2238, 1, Alnum}, {0xFF3E, 2254, 1, Alnum},
+    {0xFF3F, 2222, 1, Alnum}, {0xFF40, 2255, 1, Alnum}, {0xFF41, 1, 1, Alnum},
+    {0xFF42, 356, 1, Alnum}, {0xFF43, 61, 1, Alnum}, {0xFF44, 113, 1, Alnum},
+    {0xFF45, 49, 1, Alnum}, {0xFF46, 368, 1, Alnum}, {0xFF47, 77, 1, Alnum}, {0xFF48, 52, 1, Alnum},
+    {0xFF49, 37, 1, Alnum}, {0xFF4A, 114, 1, Alnum}, {0xFF4B, 53, 1, Alnum}, {0xFF4C, 54, 1, Alnum},
+    {0xFF4D, 55, 1, Alnum}, {0xFF4E, 48, 1, Alnum}, {0xFF4F, 6, 1, Alnum}, {0xFF50, 56, 1, Alnum},
+    {0xFF51, 401, 1, Alnum}, {0xFF52, 404, 1, Alnum}, {0xFF53, 57, 1, Alnum},
+    {0xFF54, 58, 1, Alnum}, {0xFF55, 73, 1, Alnum}, {0xFF56, 190, 1, Alnum},
+    {0xFF57, 419, 1, Alnum}, {0xFF58, 50, 1, Alnum}, {0xFF59, 425, 1, Alnum},
+    {0xFF5A, 428, 1, Alnum}, {0xFF5B, 2223, 1, Alnum}, {0xFF5C, 2256, 1, Alnum},
+    {0xFF5D, 2224, 1, Alnum}, {0xFF5E, 2257, 1, Alnum}, {0xFF5F, 2258, 1, Alnum},
+    {0xFF60, 2259, 1, Alnum}, {0xFF61, 2260, 1, Kana}, {0xFF62, 2233, 1, Kana},
+    {0xFF63, 2234, 1, Kana}, {0xFF64, 2261, 1, Kana}, {0xFF65, 2262, 1, Kana},
+    {0xFF66, 1118, 1, Kana}, {0xFF67, 1128, 1, Kana}, {0xFF68, 1296, 1, Kana},
+    {0xFF69, 2263, 1, Kana}, {0xFF6A, 1302, 1, Kana}, {0xFF6B, 1144, 1, Kana},
+    {0xFF6C, 2264, 1, Kana}, {0xFF6D, 1184, 1, Kana}, {0xFF6E, 1363, 1, Kana},
+    {0xFF6F, 1166, 1, Kana}, {0xFF70, 1123, 1, Kana}, {0xFF71, 1074, 1, Kana},
+    {0xFF72, 1075, 1, Kana}, {0xFF73, 1076, 1, Kana}, {0xFF74, 1077, 1, Kana},
+    {0xFF75, 1078, 1, Kana}, {0xFF76, 1079, 1, Kana}, {0xFF77, 1080, 1, Kana},
+    {0xFF78, 1081, 1, Kana}, {0xFF79, 1082, 1, Kana}, {0xFF7A, 657, 1, Kana},
+    {0xFF7B, 1083, 1, Kana}, {0xFF7C, 1084, 1, Kana}, {0xFF7D, 1085, 1, Kana},
+    {0xFF7E, 1086, 1, Kana}, {0xFF7F, 1087, 1, Kana}, {0xFF80, 1088, 1, Kana},
+    {0xFF81, 1089, 1, Kana}, {0xFF82, 1090, 1, Kana}, {0xFF83, 1091, 1, Kana},
+    {0xFF84, 658, 1, Kana}, {0xFF85, 1092, 1, Kana}, {0xFF86, 1093, 1, Kana},
+    {0xFF87, 1094, 1, Kana}, {0xFF88, 1095, 1, Kana}, {0xFF89, 1096, 1, Kana},
+    {0xFF8A, 1097, 1, Kana}, {0xFF8B, 1098, 1, Kana}, {0xFF8C, 1099, 1, Kana},
+    {0xFF8D, 1100, 1, Kana}, {0xFF8E, 1101, 1, Kana}, {0xFF8F, 1102, 1, Kana},
+    {0xFF90, 1103, 1, Kana}, {0xFF91, 1104, 1, Kana}, {0xFF92, 1105, 1, Kana},
+    {0xFF93, 1106, 1, Kana}, {0xFF94, 1107, 1, Kana}, {0xFF95, 1108, 1, Kana},
+    {0xFF96, 1109, 1, Kana}, {0xFF97, 1110, 1, Kana}, {0xFF98, 1111, 1, Kana},
+    {0xFF99, 1112, 1, Kana}, {0xFF9A, 1113, 1, Kana}, {0xFF9B, 1114, 1, Kana},
+    {0xFF9C, 1115, 1, Kana}, {0xFF9D, 1130, 1, Kana}, {0xFFA0, 710, 1, Compat},
+    {0xFFA1, 659, 1, Compat}, {0xFFA2, 660, 1, Compat}, {0xFFA3, 661, 1, Compat},
+    {0xFFA4, 662, 1, Compat}, {0xFFA5, 663, 1, Compat}, {0xFFA6, 664, 1, Compat},
+    {0xFFA7, 665, 1, Compat}, {0xFFA8, 666, 1, Compat}, {0xFFA9, 667, 1, Compat},
+    {0xFFAA, 668, 1, Compat}, {0xFFAB, 669, 1, Compat}, {0xFFAC, 670, 1, Compat},
+    {0xFFAD, 671, 1, Compat}, {0xFFAE, 672, 1, Compat}, {0xFFAF, 673, 1, Compat},
+    {0xFFB0, 674, 1, Compat}, {0xFFB1, 675, 1, Compat}, {0xFFB2, 676, 1, Compat},
+    {0xFFB3, 677, 1, Compat}, {0xFFB4, 678, 1, Compat}, {0xFFB5, 679, 1, Compat},
+    {0xFFB6, 680, 1, Compat}, {0xFFB7, 681, 1, Compat}, {0xFFB8, 682, 1, Compat},
+    {0xFFB9, 683, 1, Compat}, {0xFFBA, 684, 1, Compat}, {0xFFBB, 685, 1, Compat},
+    {0xFFBC, 686, 1, Compat}, {0xFFBD, 687, 1, Compat}, {0xFFBE, 688, 1, Compat},
+    {0xFFC2, 689, 1, Compat}, {0xFFC3, 690, 1, Compat}, {0xFFC4, 691, 1, Compat},
+    {0xFFC5, 692, 1, Compat}, {0xFFC6, 693, 1, Compat}, {0xFFC7, 694, 1, Compat},
+    {0xFFCA, 695, 1, Compat}, {0xFFCB, 696, 1, Compat}, {0xFFCC, 697, 1, Compat},
+    {0xFFCD, 698, 1, Compat}, {0xFFCE, 699, 1, Compat}, {0xFFCF, 700, 1, Compat},
+    {0xFFD2, 701, 1, Compat}, {0xFFD3, 702, 1, Compat}, {0xFFD4, 703, 1, Compat},
+    {0xFFD5, 704, 1, Compat}, {0xFFD6, 705, 1, Compat}, {0xFFD7, 706, 1, Compat},
+    {0xFFDA, 707, 1, Compat}, {0xFFDB, 708, 1, Compat}, {0xFFDC, 709, 1, Compat},
+    {0xFFE0, 2265, 1, Alnum}, {0xFFE1, 2266, 1, Alnum}, {0xFFE2, 2267, 1, Alnum},
+    {0xFFE4, 2268, 1, Alnum}, {0xFFE5, 2269, 1, Alnum}, {0xFFE6, 2270, 1, Alnum},
+    {0xFFE8, 2271, 1, Compat}, {0xFFE9, 2272, 1, Compat}, {0xFFEA, 2273, 1, Compat},
+    {0xFFEB, 2274, 1, Compat}, {0xFFEC, 2275, 1, Compat}, {0xFFED, 2276, 1, Compat},
+    {0xFFEE, 2277, 1, Compat},
+};
+
+const char32_t pool[] = {
+    0x0020, 0x0061, 0x0032, 0x0033, 0x03BC, 0x0031, 0x006F, 0x0031, 0x2044, 0x0034, 0x0031, 0x2044,
+    0x0032, 0x0033, 0x2044, 0x0034, 0x2010, 0x002E, 0x002E, 0x002E, 0x2032, 0x2032, 0x2032, 0x2032,
+    0x2032, 0x2035, 0x2035, 0x2035, 0x2035, 0x2035, 0x0021, 0x0021, 0x003F, 0x003F, 0x003F, 0x0021,
+    0x0030, 0x0069, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B, 0x2212, 0x003D, 0x0028, 0x0029,
+    0x006E, 0x0065, 0x0078, 0x0259, 0x0068, 0x006B, 0x006C, 0x006D, 0x0070, 0x0073, 0x0074, 0x0061,
+    0x002F, 0x0063, 0x0061, 0x002F, 0x0073, 0x0043, 0x00B0, 0x0043, 0x0063, 0x002F, 0x006F, 0x0063,
+    0x002F, 0x0075, 0x0190, 0x00B0, 0x0046, 0x0067, 0x0048, 0x0127, 0x0049, 0x004C, 0x004E, 0x004E,
+    0x006F, 0x0050, 0x0051, 0x0052, 0x0053, 0x004D, 0x0054, 0x0045, 0x004C, 0x0054, 0x004D, 0x005A,
+    0x03A9, 0x004B, 0x00C5, 0x0042, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x0046, 0x0041, 0x0058, 0x03C0,
+    0x03B3, 0x0393, 0x03A0, 0x2211, 0x0044, 0x0064, 0x006A, 0x0031, 0x2044, 0x0037, 0x0031, 0x2044,
+    0x0039, 0x0031, 0x2044, 0x0031, 0x0030, 0x0031, 0x2044, 0x0033, 0x0032, 0x2044, 0x0033, 0x0031,
+    0x2044, 0x0035, 0x0032, 0x2044, 0x0035, 0x0033, 0x2044, 0x0035, 0x0034, 0x2044, 0x0035, 0x0031,
+    0x2044, 0x0036, 0x0035, 0x2044, 0x0036, 0x0031, 0x2044, 0x0038, 0x0033, 0x2044, 0x0038, 0x0035,
+    0x2044, 0x0038, 0x0037, 0x2044, 0x0038, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0056,
+    0x0056, 0x0049, 0x0056, 0x0049, 0x0049, 0x0056, 0x0049, 0x0049, 0x0049, 0x0049, 0x0058, 0x0058,
+    0x0049, 0x0058, 0x0049, 0x0049, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0076, 0x0076,
+    0x0069, 0x0076, 0x0069, 0x0069, 0x0076, 0x0069, 0x0069, 0x0069, 0x0069, 0x0078, 0x0078, 0x0069,
+    0x0078, 0x0069, 0x0069, 0x0030, 0x2044, 0x0033, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0033,
+    0x0031, 0x0034, 0x0031, 0x0035, 0x0031, 0x0036, 0x0031, 0x0037, 0x0031, 0x0038, 0x0031, 0x0039,
+    0x0032, 0x0030, 0x0028, 0x0031, 0x0029, 0x0028, 0x0032, 0x0029, 0x0028, 0x0033, 0x0029, 0x0028,
+    0x0034, 0x0029, 0x0028, 0x0035, 0x0029, 0x0028, 0x0036, 0x0029, 0x0028, 0x0037, 0x0029, 0x0028,
+    0x0038, 0x0029, 0x0028, 0x0039, 0x0029, 0x0028, 0x0031, 0x0030, 0x0029, 0x0028, 0x0031, 0x0031,
+    0x0029, 0x0028, 0x0031, 0x0032, 0x0029, 0x0028, 0x0031, 0x0033, 0x0029, 0x0028, 0x0031, 0x0034,
+    0x0029, 0x0028, 0x0031, 0x0035, 0x0029, 0x0028, 0x0031, 0x0036, 0x0029, 0x0028, 0x0031, 0x0037,
+    0x0029, 0x0028, 0x0031, 0x0038, 0x0029, 0x0028, 0x0031, 0x0039, 0x0029, 0x0028, 0x0032, 0x0030,
+    0x0029, 0x0031, 0x002E, 0x0032, 0x002E, 0x0033, 0x002E, 0x0034, 0x002E, 0x0035, 0x002E, 0x0036,
+    0x002E, 0x0037, 0x002E, 0x0038, 0x002E, 0x0039, 0x002E, 0x0031, 0x0030, 0x002E, 0x0031, 0x0031,
+    0x002E, 0x0031, 0x0032, 0x002E, 0x0031, 0x0033, 0x002E, 0x0031, 0x0034, 0x002E, 0x0031, 0x0035,
+    0x002E, 0x0031, 0x0036, 0x002E, 0x0031, 0x0037, 0x002E, 0x0031, 0x0038, 0x002E, 0x0031, 0x0039,
+    0x002E, 0x0032, 0x0030, 0x002E, 0x0028, 0x0061, 0x0029, 0x0028, 0x0062, 0x0029, 0x0028, 0x0063,
+    0x0029, 0x0028, 0x0064, 0x0029, 0x0028, 0x0065, 0x0029, 0x0028, 0x0066, 0x0029, 0x0028, 0x0067,
+    0x0029, 0x0028, 0x0068, 0x0029, 0x0028, 0x0069, 0x0029, 0x0028, 0x006A, 0x0029, 0x0028, 0x006B,
+    0x0029, 0x0028, 0x006C, 0x0029, 0x0028, 0x006D, 0x0029, 0x0028, 0x006E, 0x0029, 0x0028, 0x006F,
+    0x0029, 0x0028, 0x0070, 0x0029, 0x0028, 0x0071, 0x0029, 0x0028, 0x0072, 0x0029, 0x0028, 0x0073,
+    0x0029, 0x0028, 0x0074, 0x0029, 0x0028, 0x0075, 0x0029, 0x0028, 0x0076, 0x0029, 0x0028, 0x0077,
+    0x0029, 0x0028, 0x0078, 0x0029, 0x0028, 0x0079, 0x0029, 0x0028, 0x007A, 0x0029, 0x0047, 0x004A,
+    0x004F, 0x0055, 0x0057, 0x0059, 0x6BCD, 0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85,
+    0x4E8C, 0x4EA0, 0x4EBA, 0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5, 0x5200,
+    0x529B, 0x52F9, 0x5315, 0x531A, 0x5338, 0x5341, 0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3,
+    0x56D7, 0x571F, 0x58EB, 0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F,
+    0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4,
+    0x5EFE, 0x5F0B, 0x5F13, 0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F, 0x6534,
+    0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79,
+    0x6BB3, 0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F,
+    0x7247, 0x7259, 0x725B, 0x72AC, 0x7384, 0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530,
+    0x758B, 0x7592, 0x7676, 0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A, 0x79B8,
+    0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36, 0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C,
+    0x8012, 0x8033, 0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F, 0x826E,
+    0x8272, 0x8278, 0x864D, 0x866B, 0x8840, 0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37,
+    0x8C46, 0x8C55, 0x8C78, 0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0, 0x8FB5,
+    0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751,
+    0x975E, 0x9762, 0x9769, 0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999,
+    0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25, 0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F,
+    0x9EA5, 0x9EBB, 0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B, 0x9F4A,
+    0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x3012, 0x5344, 0x5345, 0x3088, 0x308A, 0x30B3, 0x30C8, 0x1100,
+    0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3,
+    0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D,
+    0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167,
+    0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173,
+    0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9,
+    0x111C, 0x11DD, 0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112B, 0x112C,
+    0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140, 0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158,
+    0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0x4E09, 0x56DB, 0x4E0A,
+    0x4E2D, 0x4E0B, 0x7532, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x0028, 0x1100, 0x0029, 0x0028, 0x1102,
+    0x0029, 0x0028, 0x1103, 0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106, 0x0029, 0x0028, 0x1107,
+    0x0029, 0x0028, 0x1109, 0x0029, 0x0028, 0x110B, 0x0029, 0x0028, 0x110C, 0x0029, 0x0028, 0x110E,
+    0x0029, 0x0028, 0x110F, 0x0029, 0x0028, 0x1110, 0x0029, 0x0028, 0x1111, 0x0029, 0x0028, 0x1112,
+    0x0029, 0x0028, 0xAC00, 0x0029, 0x0028, 0xB098, 0x0029, 0x0028, 0xB2E4, 0x0029, 0x0028, 0xB77C,
+    0x0029, 0x0028, 0xB9C8, 0x0029, 0x0028, 0xBC14, 0x0029, 0x0028, 0xC0AC, 0x0029, 0x0028, 0xC544,
+    0x0029, 0x0028, 0xC790, 0x0029, 0x0028, 0xCC28, 0x0029, 0x0028, 0xCE74, 0x0029, 0x0028, 0xD0C0,
+    0x0029, 0x0028, 0xD30C, 0x0029, 0x0028, 0xD558, 0x0029, 0x0028, 0xC8FC, 0x0029, 0x0028, 0xC624,
+    0xC804, 0x0029, 0x0028, 0xC624, 0xD6C4, 0x0029, 0x0028, 0x4E00, 0x0029, 0x0028, 0x4E8C, 0x0029,
+    0x0028, 0x4E09, 0x0029, 0x0028, 0x56DB, 0x0029, 0x0028, 0x4E94, 0x0029, 0x0028, 0x516D, 0x0029,
+    0x0028, 0x4E03, 0x0029, 0x0028, 0x516B, 0x0029, 0x0028, 0x4E5D, 0x0029, 0x0028, 0x5341, 0x0029,
+    0x0028, 0x6708, 0x0029, 0x0028, 0x706B, 0x0029, 0x0028, 0x6C34, 0x0029, 0x0028, 0x6728, 0x0029,
+    0x0028, 0x91D1, 0x0029, 0x0028, 0x571F, 0x0029, 0x0028, 0x65E5, 0x0029, 0x0028, 0x682A, 0x0029,
+    0x0028, 0x6709, 0x0029, 0x0028, 0x793E, 0x0029, 0x0028, 0x540D, 0x0029, 0x0028, 0x7279, 0x0029,
+    0x0028, 0x8CA1, 0x0029, 0x0028, 0x795D, 0x0029, 0x0028, 0x52B4, 0x0029, 0x0028, 0x4EE3, 0x0029,
+    0x0028, 0x547C, 0x0029, 0x0028, 0x5B66, 0x0029, 0x0028, 0x76E3, 0x0029, 0x0028, 0x4F01, 0x0029,
+    0x0028, 0x8CC7, 0x0029, 0x0028, 0x5354, 0x0029, 0x0028, 0x796D, 0x0029, 0x0028, 0x4F11, 0x0029,
+    0x0028, 0x81EA, 0x0029, 0x0028, 0x81F3, 0x0029, 0x554F, 0x5E7C, 0x7B8F, 0x0050, 0x0054, 0x0045,
+    0x0032, 0x0032, 0x0032, 0x0034, 0x0032, 0x0035, 0x0032, 0x0036, 0x0032, 0x0037, 0x0032, 0x0038,
+    0x0032, 0x0039, 0x0033, 0x0030, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0035, 0xCC38, 0xACE0,
+    0xC8FC, 0xC758, 0xC6B0, 0x79D8, 0x7537, 0x9069, 0x512A, 0x5370, 0x6CE8, 0x9805, 0x5199, 0x6B63,
+    0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x591C, 0x0033, 0x0036, 0x0033, 0x0037, 0x0033, 0x0038, 0x0033,
+    0x0039, 0x0034, 0x0030, 0x0034, 0x0034, 0x0034, 0x0035, 0x0034, 0x0036, 0x0034, 0x0037, 0x0034,
+    0x0038, 0x0034, 0x0039, 0x0035, 0x0030, 0x0031, 0x6708, 0x0032, 0x6708, 0x0033, 0x6708, 0x0034,
+    0x6708, 0x0035, 0x6708, 0x0036, 0x6708, 0x0037, 0x6708, 0x0038, 0x6708, 0x0039, 0x6708, 0x0031,
+    0x0030, 0x6708, 0x0031, 0x0031, 0x6708, 0x0031, 0x0032, 0x6708, 0x0048, 0x0067, 0x0065, 0x0072,
+    0x0067, 0x0065, 0x0056, 0x004C, 0x0054, 0x0044, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB,
+    0x30AD, 0x30AF, 0x30B1, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6,
+    0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF,
+    0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF,
+    0x30F0, 0x30F1, 0x30F2, 0x4EE4, 0x548C, 0x30A2, 0x30D1, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5,
+    0x30A1, 0x30A2, 0x30F3, 0x30DA, 0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30B0,
+    0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C9, 0x30A8,
+    0x30FC, 0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA,
+    0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AC, 0x30ED, 0x30F3, 0x30AC,
+    0x30F3, 0x30DE, 0x30AE, 0x30AC, 0x30AE, 0x30CB, 0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AE,
+    0x30EB, 0x30C0, 0x30FC, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30B0, 0x30E9, 0x30E0, 0x30AD, 0x30ED,
+    0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30B0, 0x30E9, 0x30E0,
+    0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BC, 0x30A4, 0x30ED, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1,
+    0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DD, 0x30B5, 0x30A4, 0x30AF, 0x30EB,
+    0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3, 0x30B0, 0x30BB, 0x30F3, 0x30C1,
+    0x30BB, 0x30F3, 0x30C8, 0x30C0, 0x30FC, 0x30B9, 0x30C7, 0x30B7, 0x30C9, 0x30EB, 0x30CA, 0x30CE,
+    0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30D1, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30D1,
+    0x30FC, 0x30C4, 0x30D0, 0x30FC, 0x30EC, 0x30EB, 0x30D4, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D4,
+    0x30AF, 0x30EB, 0x30D4, 0x30B3, 0x30D3, 0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C9, 0x30D5,
+    0x30A3, 0x30FC, 0x30C8, 0x30D6, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3, 0x30D8,
+    0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30DA, 0x30BD, 0x30DA, 0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4,
+    0x30DA, 0x30F3, 0x30B9, 0x30DA, 0x30FC, 0x30B8, 0x30D9, 0x30FC, 0x30BF, 0x30DD, 0x30A4, 0x30F3,
+    0x30C8, 0x30DC, 0x30EB, 0x30C8, 0x30DB, 0x30F3, 0x30DD, 0x30F3, 0x30C9, 0x30DB, 0x30FC, 0x30EB,
+    0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3,
+    0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED,
+    0x30F3, 0x30DF, 0x30EA, 0x30DF, 0x30EA, 0x30D0, 0x30FC, 0x30EB, 0x30E1, 0x30AC, 0x30E1, 0x30AC,
+    0x30C8, 0x30F3, 0x30E4, 0x30FC, 0x30C9, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA,
+    0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB, 0x30D4, 0x30FC, 0x30EB, 0x30FC, 0x30D6, 0x30EB,
+    0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30B2, 0x30F3, 0x0030, 0x70B9, 0x0031, 0x70B9, 0x0032,
+    0x70B9, 0x0033, 0x70B9, 0x0034, 0x70B9, 0x0035, 0x70B9, 0x0036, 0x70B9, 0x0037, 0x70B9, 0x0038,
+    0x70B9, 0x0039, 0x70B9, 0x0031, 0x0030, 0x70B9, 0x0031, 0x0031, 0x70B9, 0x0031, 0x0032, 0x70B9,
+    0x0031, 0x0033, 0x70B9, 0x0031, 0x0034, 0x70B9, 0x0031, 0x0035, 0x70B9, 0x0031, 0x0036, 0x70B9,
+    0x0031, 0x0037, 0x70B9, 0x0031, 0x0038, 0x70B9, 0x0031, 0x0039, 0x70B9, 0x0032, 0x0030, 0x70B9,
+    0x0032, 0x0031, 0x70B9, 0x0032, 0x0032, 0x70B9, 0x0032, 0x0033, 0x70B9, 0x0032, 0x0034, 0x70B9,
+    0x0068, 0x0050, 0x0061, 0x0064, 0x0061, 0x0041, 0x0055, 0x0062, 0x0061, 0x0072, 0x006F, 0x0056,
+    0x0070, 0x0063, 0x0064, 0x006D, 0x0064, 0x006D, 0x0032, 0x0064, 0x006D, 0x0033, 0x0049, 0x0055,
+    0x5E73, 0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A, 0x5F0F, 0x4F1A, 0x793E,
+    0x0070, 0x0041, 0x006E, 0x0041, 0x03BC, 0x0041, 0x006D, 0x0041, 0x006B, 0x0041, 0x004B, 0x0042,
+    0x004D, 0x0042, 0x0047, 0x0042, 0x0063, 0x0061, 0x006C, 0x006B, 0x0063, 0x0061, 0x006C, 0x0070,
+    0x0046, 0x006E, 0x0046, 0x03BC, 0x0046, 0x03BC, 0x0067, 0x006D, 0x0067, 0x006B, 0x0067, 0x0048,
+    0x007A, 0x006B, 0x0048, 0x007A, 0x004D, 0x0048, 0x007A, 0x0047, 0x0048, 0x007A, 0x0054, 0x0048,
+    0x007A, 0x03BC, 0x006C, 0x006D, 0x006C, 0x0064, 0x006C, 0x0066, 0x006D, 0x006E, 0x006D, 0x03BC,
+    0x006D, 0x006D, 0x006D, 0x0063, 0x006D, 0x006B, 0x006D, 0x006D, 0x006D, 0x0032, 0x0063, 0x006D,
+    0x0032, 0x006B, 0x006D, 0x0032, 0x006D, 0x006D, 0x0033, 0x0063, 0x006D, 0x0033, 0x006B, 0x006D,
+    0x0033, 0x006D, 0x2215, 0x0073, 0x006D, 0x2215, 0x0073, 0x0032, 0x006B, 0x0050, 0x0061, 0x004D,
+    0x0050, 0x0061, 0x0047, 0x0050, 0x0061, 0x0072, 0x0061, 0x0064, 0x0072, 0x0061, 0x0064, 0x2215,
+    0x0073, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x006E, 0x0073, 0x03BC, 0x0073, 0x006D,
+    0x0073, 0x0070, 0x0056, 0x006E, 0x0056, 0x03BC, 0x0056, 0x006D, 0x0056, 0x006B, 0x0056, 0x004D,
+    0x0056, 0x0070, 0x0057, 0x006E, 0x0057, 0x03BC, 0x0057, 0x006D, 0x0057, 0x006B, 0x0057, 0x004D,
+    0x0057, 0x006B, 0x03A9, 0x004D, 0x03A9, 0x0061, 0x002E, 0x006D, 0x002E, 0x0042, 0x0071, 0x0063,
+    0x0063, 0x0043, 0x2215, 0x006B, 0x0067, 0x0043, 0x006F, 0x002E, 0x0064, 0x0042, 0x0047, 0x0079,
+    0x0068, 0x0061, 0x0048, 0x0050, 0x0069, 0x006E, 0x004B, 0x004B, 0x004B, 0x004D, 0x006B, 0x0074,
+    0x006C, 0x006E, 0x006C, 0x006F, 0x0067, 0x006C, 0x0078, 0x006D, 0x0062, 0x006D, 0x0069, 0x006C,
+    0x006D, 0x006F, 0x006C, 0x0050, 0x0048, 0x0070, 0x002E, 0x006D, 0x002E, 0x0050, 0x0050, 0x004D,
+    0x0050, 0x0052, 0x0053, 0x0076, 0x0057, 0x0062, 0x0056, 0x2215, 0x006D, 0x0041, 0x2215, 0x006D,
+    0x0031, 0x65E5, 0x0032, 0x65E5, 0x0033, 0x65E5, 0x0034, 0x65E5, 0x0035, 0x65E5, 0x0036, 0x65E5,
+    0x0037, 0x65E5, 0x0038, 0x65E5, 0x0039, 0x65E5, 0x0031, 0x0030, 0x65E5, 0x0031, 0x0031, 0x65E5,
+    0x0031, 0x0032, 0x65E5, 0x0031, 0x0033, 0x65E5, 0x0031, 0x0034, 0x65E5, 0x0031, 0x0035, 0x65E5,
+    0x0031, 0x0036, 0x65E5, 0x0031, 0x0037, 0x65E5, 0x0031, 0x0038, 0x65E5, 0x0031, 0x0039, 0x65E5,
+    0x0032, 0x0030, 0x65E5, 0x0032, 0x0031, 0x65E5, 0x0032, 0x0032, 0x65E5, 0x0032, 0x0033, 0x65E5,
+    0x0032, 0x0034, 0x65E5, 0x0032, 0x0035, 0x65E5, 0x0032, 0x0036, 0x65E5, 0x0032, 0x0037, 0x65E5,
+    0x0032, 0x0038, 0x65E5, 0x0032, 0x0039, 0x65E5, 0x0033, 0x0030, 0x65E5, 0x0033, 0x0031, 0x65E5,
+    0x0067, 0x0061, 0x006C, 0x8C48, 0x66F4, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x5951, 0x5587, 0x5948,
+    0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D,
+    0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964,
+    0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4,
+    0x6AD3, 0x7210, 0x76E7, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0,
+    0x83C9, 0x9304, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8,
+    0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C,
+    0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317,
+    0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA,
+    0x6BBA, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F,
+    0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE,
+    0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+    0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x5EC9, 0x5FF5,
+    0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x56F9, 0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234,
+    0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F,
+    0x6599, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C,
+    0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B,
+    0x6144, 0x6817, 0x9686, 0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2,
+    0x7F79, 0x88CF, 0x88E1, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57,
+    0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A,
+    0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x964D, 0x5ED3, 0x5140, 0x55C0,
+    0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x8612,
+    0x8AF8, 0x9038, 0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+    0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8, 0x5C64, 0x6094, 0x6168, 0x618E,
+    0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891,
+    0x7949, 0x7948, 0x7950, 0x7956, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7E09, 0x7E41, 0x7F72,
+    0x8005, 0x81ED, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x96E3,
+    0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7,
+    0x52FA, 0x5555, 0x5599, 0x55E2, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69,
+    0x5FAD, 0x60D8, 0x614E, 0x6108, 0x6160, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x671B, 0x6756,
+    0x6EDB, 0x6ECB, 0x701E, 0x77A7, 0x7235, 0x72AF, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76DB,
+    0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7C7B, 0x7D5B, 0x7F3E, 0x8352, 0x83EF, 0x8779, 0x8941,
+    0x8986, 0x8ABF, 0x8ACB, 0x8AED, 0x8B8A, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x97DB, 0x980B,
+    0x9B12, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43,
+    0x9F8E, 0x2014, 0x2013, 0x005F, 0x007B, 0x007D, 0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B,
+    0x3008, 0x3009, 0x300C, 0x300D, 0x300E, 0x300F, 0x005B, 0x005D, 0x0022, 0x0023, 0x0024, 0x0025,
+    0x0026, 0x0027, 0x002A, 0x002C, 0x002D, 0x003A, 0x003B, 0x003C, 0x003E, 0x0040, 0x005C, 0x005E,
+    0x0060, 0x007C, 0x007E, 0x2985, 0x2986, 0x3002, 0x3001, 0x30FB, 0x30A5, 0x30E3, 0x00A2, 0x00A3,
+    0x00AC, 0x00A6, 0x00A5, 0x20A9, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB,
+};
+
+// かな + 結合用濁点(U+3099)・半濁点(U+309A) → 合成済みの文字
+struct Composition {
+    char32_t base;
+    char32_t mark;
+    char32_t composed;
+};
+
+const Composition compositions[] = {
+    {0x3046, 0x3099, 0x3094}, {0x304B, 0x3099, 0x304C}, {0x304D, 0x3099, 0x304E},
+    {0x304F, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058}, {0x3059, 0x3099, 0x305A},
+    {0x305B, 0x3099, 0x305C}, {0x305D, 0x3099, 0x305E}, {0x305F, 0x3099, 0x3060},
+    {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065}, {0x3066, 0x3099, 0x3067},
+    {0x3068, 0x3099, 0x3069}, {0x306F, 0x3099, 0x3070}, {0x306F, 0x309A, 0x3071},
+    {0x3072, 0x3099, 0x3073}, {0x3072, 0x309A, 0x3074}, {0x3075, 0x3099, 0x3076},
+    {0x3075, 0x309A, 0x3077}, {0x3078, 0x3099, 0x3079}, {0x3078, 0x309A, 0x307A},
+    {0x307B, 0x3099, 0x307C}, {0x307B, 0x309A, 0x307D}, {0x30A6, 0x3099, 0x30F4},
+    {0x30AB, 0x3099, 0x30AC}, {0x30AD, 0x3099, 0x30AE}, {0x30AF, 0x3099, 0x30B0},
+    {0x30B1, 0x3099, 0x30B2}, {0x30B3, 0x3099, 0x30B4}, {0x30B5, 0x3099, 0x30B6},
+    {0x30B7, 0x3099, 0x30B8}, {0x30B9, 0x3099, 0x30BA}, {0x30BB, 0x3099, 0x30BC},
+    {0x30BD, 0x3099, 0x30BE}, {0x30BF, 0x3099, 0x30C0}, {0x30C1, 0x3099, 0x30C2},
+    {0x30C4, 0x3099, 0x30C5}, {0x30C6, 0x3099, 0x30C7}, {0x30C8, 0x3099, 0x30C9},
+    {0x30CF, 0x3099, 0x30D0}, {0x30CF, 0x309A, 0x30D1}, {0x30D2, 0x3099, 0x30D3},
+    {0x30D2, 0x309A, 0x30D4}, {0x30D5, 0x3099, 0x30D6}, {0x30D5, 0x309A, 0x30D7},
+    {0x30D8, 0x3099, 0x30D9}, {0x30D8, 0x309A, 0x30DA}, {0x30DB, 0x3099, 0x30DC},
+    {0x30DB, 0x309A, 0x30DD}, {0x30EF, 0x3099, 0x30F7}, {0x30F0, 0x3099, 0x30F8},
+    {0x30F1, 0x3099, 0x30F9}, {0x30F2, 0x3099, 0x30FA}, {0x309D, 0x3099, 0x309E},
+    {0x30FD, 0x3099, 0x30FE},
+};
+
+}
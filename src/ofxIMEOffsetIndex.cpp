@@ -0,0 +1,250 @@
+#include "ofxIMEOffsetIndex.h"
+
+namespace {
+    size_t unitsOf(char32_t c, ofxIMEOffsetIndex::Unit unit) {
+        switch (unit) {
+        case ofxIMEOffsetIndex::UTF16: return c < 0x10000 ? 1 : 2;
+        case ofxIMEOffsetIndex::UTF8: return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+        default: return 1;
+        }
+    }
+}
+
+ofxIMEOffsetIndex::Lengths ofxIMEOffsetIndex::measure(std::u32string_view str) {
+    Lengths l;
+    l.units[UTF32] = str.size();
+    l.units[UTF16] = str.size();
+    l.units[UTF8] = str.size();
+    for (char32_t c : str) {
+        if (c < 0x80) continue;
+        l.units[UTF16] += unitsOf(c, UTF16) - 1;
+        l.units[UTF8] += unitsOf(c, UTF8) - 1;
+    }
+    return l;
+}
+
+size_t ofxIMEOffsetIndex::convert(std::u32string_view str, size_t offset, Unit from, Unit to) {
+    if (from == to) return MIN(offset, str.size());
+    return convert(str, measure(str), offset, from, to);
+}
+
+size_t ofxIMEOffsetIndex::convert(std::u32string_view str, const Lengths &lengths, size_t offset, Unit from, Unit to) {
+    if (offset >= lengths[from]) return lengths[to];
+
+    // Equal lengths in two units only happen when every character is one
+    // unit in both (all ASCII, or all BMP for UTF-32 and UTF-16)
+    if (lengths[from] == lengths[to]) return offset;
+
+    size_t a = 0, b = 0;
+    for (char32_t c : str) {
+        size_t n = unitsOf(c, from);
+        if (a + n > offset) break;
+        a += n;
+        b += unitsOf(c, to);
+    }
+    return b;
+}
+
+int ofxIMEOffsetIndex::newNode(const Lengths &lengths) {
+    int n;
+    if (!freeNodes.empty()) {
+        n = freeNodes.back();
+        freeNodes.pop_back();
+    }
+    else {
+        n = (int)nodes.size();
+        nodes.emplace_back();
+    }
+
+    // xorshift for the heap priorities
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    Node &node = nodes[n];
+    node = Node();
+    node.length = node.sum = lengths;
+    node.priority = seed;
+    return n;
+}
+
+void ofxIMEOffsetIndex::pull(int n) {
+    Node &node = nodes[n];
+    node.size = 1;
+    node.sum = node.length;
+    for (int c : {node.left, node.right}) {
+        if (c < 0) continue;
+        node.size += nodes[c].size;
+        for (int u = 0; u < 3; ++u) node.sum.units[u] += nodes[c].sum.units[u];
+    }
+}
+
+void ofxIMEOffsetIndex::split(int t, int k, int &l, int &r) {
+    if (t < 0) {
+        l = r = -1;
+        return;
+    }
+    int leftSize = nodes[t].left < 0 ? 0 : nodes[nodes[t].left].size;
+    if (k <= leftSize) {
+        split(nodes[t].left, k, l, nodes[t].left);
+        r = t;
+    }
+    else {
+        split(nodes[t].right, k - leftSize - 1, nodes[t].right, r);
+        l = t;
+    }
+    pull(t);
+}
+
+int ofxIMEOffsetIndex::merge(int l, int r) {
+    if (l < 0) return r;
+    if (r < 0) return l;
+    if (nodes[l].priority > nodes[r].priority) {
+        nodes[l].right = merge(nodes[l].right, r);
+        pull(l);
+        return l;
+    }
+    nodes[r].left = merge(l, nodes[r].left);
+    pull(r);
+    return r;
+}
+
+void ofxIMEOffsetIndex::freeTree(int t) {
+    if (t < 0) return;
+    freeTree(nodes[t].left);
+    freeTree(nodes[t].right);
+    freeNodes.push_back(t);
+}
+
+void ofxIMEOffsetIndex::clear() {
+    nodes.clear();
+    freeNodes.clear();
+    spine.clear();
+    root = -1;
+    built = false;
+}
+
+void ofxIMEOffsetIndex::buildPush(const Lengths &lengths) {
+    // Nodes below the new one on the right spine become its left subtree;
+    // each is complete once it leaves the spine
+    int n = newNode(lengths);
+    int last = -1;
+    while (!spine.empty() && nodes[spine.back()].priority < nodes[n].priority) {
+        last = spine.back();
+        spine.pop_back();
+        pull(last);
+    }
+    nodes[n].left = last;
+    if (!spine.empty()) nodes[spine.back()].right = n;
+    spine.push_back(n);
+}
+
+void ofxIMEOffsetIndex::buildFinish() {
+    while (!spine.empty()) {
+        root = spine.back();
+        spine.pop_back();
+        pull(root);
+    }
+    built = true;
+}
+
+void ofxIMEOffsetIndex::insertLine(int at, const Lengths &lengths) {
+    if (!built) return;
+    int l, r;
+    split(root, at, l, r);
+    root = merge(merge(l, newNode(lengths)), r);
+}
+
+void ofxIMEOffsetIndex::eraseLines(int at, int n) {
+    if (!built || n <= 0) return;
+    int l, m, r;
+    split(root, at, l, r);
+    split(r, n, m, r);
+    freeTree(m);
+    root = merge(l, r);
+}
+
+void ofxIMEOffsetIndex::setLine(int at, const Lengths &lengths) {
+    if (!built) return;
+    int l, m, r;
+    split(root, at, l, r);
+    split(r, 1, m, r);
+    if (m >= 0) {
+        nodes[m].length = lengths;
+        pull(m);
+    }
+    root = merge(merge(l, m), r);
+}
+
+int ofxIMEOffsetIndex::nodeAt(int l) const {
+    int t = root;
+    while (t >= 0) {
+        int leftSize = nodes[t].left < 0 ? 0 : nodes[nodes[t].left].size;
+        if (l < leftSize) {
+            t = nodes[t].left;
+        }
+        else if (l == leftSize) {
+            return t;
+        }
+        else {
+            l -= leftSize + 1;
+            t = nodes[t].right;
+        }
+    }
+    return -1;
+}
+
+const ofxIMEOffsetIndex::Lengths &ofxIMEOffsetIndex::getLine(int l) const {
+    static const Lengths empty;
+    int n = nodeAt(l);
+    return n < 0 ? empty : nodes[n].length;
+}
+
+size_t ofxIMEOffsetIndex::getTotal(Unit unit) const {
+    return root < 0 ? 0 : total(root, unit) - 1;
+}
+
+size_t ofxIMEOffsetIndex::getLineStart(int l, Unit unit) const {
+    size_t offset = 0;
+    int t = root;
+    while (t >= 0) {
+        const Node &n = nodes[t];
+        int leftSize = n.left < 0 ? 0 : nodes[n.left].size;
+        if (l < leftSize) {
+            t = n.left;
+            continue;
+        }
+        offset += total(n.left, unit);
+        if (l == leftSize) break;
+        offset += n.length[unit] + 1;
+        l -= leftSize + 1;
+        t = n.right;
+    }
+    return offset;
+}
+
+int ofxIMEOffsetIndex::findLine(size_t offset, Unit unit, size_t &lineStart) const {
+    lineStart = 0;
+    if (root < 0) return 0;
+    offset = MIN(offset, getTotal(unit));
+
+    int index = 0;
+    int t = root;
+    while (t >= 0) {
+        const Node &n = nodes[t];
+        size_t before = total(n.left, unit);
+        if (offset < before) {
+            t = n.left;
+            continue;
+        }
+        offset -= before;
+        lineStart += before;
+        index += n.left < 0 ? 0 : nodes[n.left].size;
+        if (offset <= n.length[unit]) return index;
+        offset -= n.length[unit] + 1;
+        lineStart += n.length[unit] + 1;
+        index++;
+        t = n.right;
+    }
+    return getNumLines() - 1;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "ofMain.h"
+
+#include <string_view>
+
+// 位置の単位の変換用の索引
+// 各行の長さ（UTF-32の文字数・UTF-16の単位数・UTF-8のバイト数）を行順のtreapに持つ
+// 部分木の合計から、文書先頭からのオフセット（改行は1単位）と行の対応をO(log n)で求める
+// 行の挿入・削除・長さの変更もO(log n)なので、編集のたびに作り直さずに直せる
+class ofxIMEOffsetIndex {
+public:
+    enum Unit {
+        UTF32,      // 文字（ofxIMEBaseの行内の位置と同じ）
+        UTF16,      // NSRange、WindowsのIMMなど
+        UTF8        // バイト
+    };
+
+    // 1行分の長さ
+    struct Lengths {
+        size_t units[3] = {0, 0, 0};
+        size_t operator[](Unit u) const { return units[u]; }
+        bool operator==(const Lengths &o) const {
+            return units[0] == o.units[0] && units[1] == o.units[1] && units[2] == o.units[2];
+        }
+    };
+    static Lengths measure(std::u32string_view str);
+
+    // 1つの文字列の中の位置の変換。文字の途中を指す位置はその文字の先頭にする
+    // 長さが単位によらない文字列（ASCIIだけ、BMPだけ）は数えない
+    static size_t convert(std::u32string_view str, size_t offset, Unit from, Unit to);
+    static size_t convert(std::u32string_view str, const Lengths &lengths, size_t offset, Unit from, Unit to);
+
+    // 文書の全行から作る（Linesは文字列のコンテナ）。O(n)
+    template<typename Lines>
+    void build(const Lines &lines) {
+        clear();
+        for (auto &l : lines) buildPush(measure(l));
+        buildFinish();
+    }
+    bool isBuilt() const { return built; }
+    void clear();       // 作っていない状態に戻す
+
+    // 文書の編集に合わせて直す
+    void insertLine(int at, const Lengths &lengths);
+    void eraseLines(int at, int n);
+    void setLine(int at, const Lengths &lengths);
+
+    int getNumLines() const { return root < 0 ? 0 : nodes[root].size; }
+    const Lengths &getLine(int l) const;
+    size_t getTotal(Unit unit) const;               // 文書全体（改行を含む）
+    size_t getLineStart(int l, Unit unit) const;    // 行頭のオフセット
+
+    // offsetを含む行。行末（改行の位置）はその行に含める。文書の外は最後の行
+    // lineStartに行頭のオフセットを返す
+    int findLine(size_t offset, Unit unit, size_t &lineStart) const;
+
+private:
+    struct Node {
+        Lengths length;         // この行
+        Lengths sum;            // 部分木の行の合計（改行を除く）
+        int size = 1;           // 部分木の行数
+        uint32_t priority = 0;
+        int left = -1, right = -1;
+    };
+
+    int newNode(const Lengths &lengths);
+    void pull(int n);
+    void split(int t, int k, int &l, int &r);      // l: 先頭k行
+    int merge(int l, int r);
+    void freeTree(int t);
+    int nodeAt(int l) const;
+    size_t total(int t, Unit unit) const {
+        return t < 0 ? 0 : nodes[t].sum[unit] + nodes[t].size;
+    }
+
+    // 右端の経路を積んで、乱数の優先度のまま行順に並べる
+    void buildPush(const Lengths &lengths);
+    void buildFinish();
+
+    vector<Node> nodes;
+    vector<int> freeNodes;
+    vector<int> spine;
+    int root = -1;
+    bool built = false;
+    uint32_t seed = 2463534242u;
+};
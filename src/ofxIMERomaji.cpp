@@ -0,0 +1,230 @@
+#include "ofxIMERomaji.h"
+
+#include <array>
+
+namespace {
+    // Romaji table (MS-IME style). rest is fed again after the kana is
+    // emitted, which is how doubled consonants become "っ" + consonant
+    struct RomajiEntry {
+        const char *romaji;
+        const char32_t *kana;
+        char rest = 0;
+    };
+
+    constexpr RomajiEntry romajiTable[] = {
+        {"a", U"あ"}, {"i", U"い"}, {"u", U"う"}, {"e", U"え"}, {"o", U"お"},
+        {"ka", U"か"}, {"ki", U"き"}, {"ku", U"く"}, {"ke", U"け"}, {"ko", U"こ"},
+        {"kya", U"きゃ"}, {"kyi", U"きぃ"}, {"kyu", U"きゅ"}, {"kye", U"きぇ"}, {"kyo", U"きょ"},
+        {"sa", U"さ"}, {"si", U"し"}, {"shi", U"し"}, {"su", U"す"}, {"se", U"せ"}, {"so", U"そ"},
+        {"sha", U"しゃ"}, {"shu", U"しゅ"}, {"she", U"しぇ"}, {"sho", U"しょ"},
+        {"sya", U"しゃ"}, {"syi", U"しぃ"}, {"syu", U"しゅ"}, {"sye", U"しぇ"}, {"syo", U"しょ"},
+        {"ta", U"た"}, {"ti", U"ち"}, {"chi", U"ち"}, {"tu", U"つ"}, {"tsu", U"つ"}, {"te", U"て"}, {"to", U"と"},
+        {"cha", U"ちゃ"}, {"chu", U"ちゅ"}, {"che", U"ちぇ"}, {"cho", U"ちょ"},
+        {"tya", U"ちゃ"}, {"tyi", U"ちぃ"}, {"tyu", U"ちゅ"}, {"tye", U"ちぇ"}, {"tyo", U"ちょ"},
+        {"cya", U"ちゃ"}, {"cyi", U"ちぃ"}, {"cyu", U"ちゅ"}, {"cye", U"ちぇ"}, {"cyo", U"ちょ"},
+        {"tha", U"てゃ"}, {"thi", U"てぃ"}, {"thu", U"てゅ"}, {"the", U"てぇ"}, {"tho", U"てょ"},
+        {"na", U"な"}, {"ni", U"に"}, {"nu", U"ぬ"}, {"ne", U"ね"}, {"no", U"の"},
+        {"nya", U"にゃ"}, {"nyi", U"にぃ"}, {"nyu", U"にゅ"}, {"nye", U"にぇ"}, {"nyo", U"にょ"},
+        {"n", U"ん"}, {"nn", U"ん"}, {"n'", U"ん"},
+        {"ha", U"は"}, {"hi", U"ひ"}, {"hu", U"ふ"}, {"fu", U"ふ"}, {"he", U"へ"}, {"ho", U"ほ"},
+        {"hya", U"ひゃ"}, {"hyi", U"ひぃ"}, {"hyu", U"ひゅ"}, {"hye", U"ひぇ"}, {"hyo", U"ひょ"},
+        {"fa", U"ふぁ"}, {"fi", U"ふぃ"}, {"fe", U"ふぇ"}, {"fo", U"ふぉ"}, {"fyu", U"ふゅ"},
+        {"ma", U"ま"}, {"mi", U"み"}, {"mu", U"む"}, {"me", U"め"}, {"mo", U"も"},
+        {"mya", U"みゃ"}, {"myi", U"みぃ"}, {"myu", U"みゅ"}, {"mye", U"みぇ"}, {"myo", U"みょ"},
+        {"ya", U"や"}, {"yu", U"ゆ"}, {"ye", U"いぇ"}, {"yo", U"よ"},
+        {"ra", U"ら"}, {"ri", U"り"}, {"ru", U"る"}, {"re", U"れ"}, {"ro", U"ろ"},
+        {"rya", U"りゃ"}, {"ryi", U"りぃ"}, {"ryu", U"りゅ"}, {"rye", U"りぇ"}, {"ryo", U"りょ"},
+        {"wa", U"わ"}, {"wi", U"うぃ"}, {"we", U"うぇ"}, {"wo", U"を"},
+        {"ga", U"が"}, {"gi", U"ぎ"}, {"gu", U"ぐ"}, {"ge", U"げ"}, {"go", U"ご"},
+        {"gya", U"ぎゃ"}, {"gyi", U"ぎぃ"}, {"gyu", U"ぎゅ"}, {"gye", U"ぎぇ"}, {"gyo", U"ぎょ"},
+        {"za", U"ざ"}, {"zi", U"じ"}, {"zu", U"ず"}, {"ze", U"ぜ"}, {"zo", U"ぞ"},
+        {"zya", U"じゃ"}, {"zyi", U"じぃ"}, {"zyu", U"じゅ"}, {"zye", U"じぇ"}, {"zyo", U"じょ"},
+        {"ja", U"じゃ"}, {"ji", U"じ"}, {"ju", U"じゅ"}, {"je", U"じぇ"}, {"jo", U"じょ"},
+        {"jya", U"じゃ"}, {"jyi", U"じぃ"}, {"jyu", U"じゅ"}, {"jye", U"じぇ"}, {"jyo", U"じょ"},
+        {"da", U"だ"}, {"di", U"ぢ"}, {"du", U"づ"}, {"de", U"で"}, {"do", U"ど"},
+        {"dya", U"ぢゃ"}, {"dyi", U"ぢぃ"}, {"dyu", U"ぢゅ"}, {"dye", U"ぢぇ"}, {"dyo", U"ぢょ"},
+        {"dha", U"でゃ"}, {"dhi", U"でぃ"}, {"dhu", U"でゅ"}, {"dhe", U"でぇ"}, {"dho", U"でょ"},
+        {"ba", U"ば"}, {"bi", U"び"}, {"bu", U"ぶ"}, {"be", U"べ"}, {"bo", U"ぼ"},
+        {"bya", U"びゃ"}, {"byi", U"びぃ"}, {"byu", U"びゅ"}, {"bye", U"びぇ"}, {"byo", U"びょ"},
+        {"pa", U"ぱ"}, {"pi", U"ぴ"}, {"pu", U"ぷ"}, {"pe", U"ぺ"}, {"po", U"ぽ"},
+        {"pya", U"ぴゃ"}, {"pyi", U"ぴぃ"}, {"pyu", U"ぴゅ"}, {"pye", U"ぴぇ"}, {"pyo", U"ぴょ"},
+        {"va", U"ゔぁ"}, {"vi", U"ゔぃ"}, {"vu", U"ゔ"}, {"ve", U"ゔぇ"}, {"vo", U"ゔぉ"},
+        {"ca", U"か"}, {"ci", U"し"}, {"cu", U"く"}, {"ce", U"せ"}, {"co", U"こ"},
+        {"qa", U"くぁ"}, {"qi", U"くぃ"}, {"qu", U"く"}, {"qe", U"くぇ"}, {"qo", U"くぉ"},
+        {"la", U"ぁ"}, {"li", U"ぃ"}, {"lu", U"ぅ"}, {"le", U"ぇ"}, {"lo", U"ぉ"},
+        {"lya", U"ゃ"}, {"lyu", U"ゅ"}, {"lyo", U"ょ"}, {"ltu", U"っ"}, {"ltsu", U"っ"}, {"lwa", U"ゎ"},
+        {"xa", U"ぁ"}, {"xi", U"ぃ"}, {"xu", U"ぅ"}, {"xe", U"ぇ"}, {"xo", U"ぉ"},
+        {"xya", U"ゃ"}, {"xyu", U"ゅ"}, {"xyo", U"ょ"}, {"xtu", U"っ"}, {"xtsu", U"っ"}, {"xwa", U"ゎ"},
+        {"xka", U"ゕ"}, {"xke", U"ゖ"},
+        {"kk", U"っ", 'k'}, {"ss", U"っ", 's'}, {"tt", U"っ", 't'}, {"tc", U"っ", 'c'},
+        {"hh", U"っ", 'h'}, {"ff", U"っ", 'f'}, {"mm", U"っ", 'm'}, {"yy", U"っ", 'y'},
+        {"rr", U"っ", 'r'}, {"ww", U"っ", 'w'}, {"gg", U"っ", 'g'}, {"zz", U"っ", 'z'},
+        {"jj", U"っ", 'j'}, {"dd", U"っ", 'd'}, {"bb", U"っ", 'b'}, {"pp", U"っ", 'p'},
+        {"vv", U"っ", 'v'}, {"cc", U"っ", 'c'}, {"qq", U"っ", 'q'},
+        {"-", U"ー"}, {",", U"、"}, {".", U"。"}, {"[", U"「"}, {"]", U"」"},
+        {"~", U"〜"}, {"/", U"・"},
+    };
+
+    // Input symbols of the DFA
+    constexpr char romajiSymbols[] = "abcdefghijklmnopqrstuvwxyz-,.[]~/'";
+    constexpr int numSymbols = sizeof(romajiSymbols) - 1;
+
+    constexpr int symbolOf(char32_t c) {
+        for (int i = 0; i < numSymbols; ++i) {
+            if ((char32_t)romajiSymbols[i] == c) return i;
+        }
+        return -1;
+    }
+
+    constexpr size_t length(const char *s) {
+        size_t n = 0;
+        while (s[n]) n++;
+        return n;
+    }
+
+    // Every prefix of every romaji string is a state, plus the initial one
+    constexpr size_t maxStates() {
+        size_t n = 1;
+        for (auto &e : romajiTable) n += length(e.romaji);
+        return n;
+    }
+
+    struct RomajiState {
+        uint16_t next[numSymbols] = {};    // 0 = no transition
+        char32_t kana[3] = {};
+        uint8_t kanaLength = 0;            // 0 = not the end of an entry
+        char rest = 0;
+        bool hasNext = false;
+    };
+
+    struct RomajiDFA {
+        std::array<RomajiState, maxStates()> states = {};
+        size_t numStates = 1;
+        bool valid = true;                 // every symbol known, no duplicate entries
+    };
+
+    constexpr RomajiDFA buildRomajiDFA() {
+        RomajiDFA dfa;
+        for (auto &e : romajiTable) {
+            size_t node = 0;
+            for (const char *p = e.romaji; *p; ++p) {
+                int sym = symbolOf((unsigned char)*p);
+                if (sym < 0) {
+                    dfa.valid = false;
+                    return dfa;
+                }
+                if (dfa.states[node].next[sym] == 0) {
+                    dfa.states[node].next[sym] = (uint16_t)dfa.numStates++;
+                    dfa.states[node].hasNext = true;
+                }
+                node = dfa.states[node].next[sym];
+            }
+
+            RomajiState &s = dfa.states[node];
+            if (s.kanaLength > 0) dfa.valid = false;
+            for (const char32_t *k = e.kana; *k && s.kanaLength < 3; ++k) {
+                s.kana[s.kanaLength++] = *k;
+            }
+            s.rest = e.rest;
+        }
+        return dfa;
+    }
+
+    constexpr RomajiDFA romajiDFA = buildRomajiDFA();
+    static_assert(romajiDFA.valid, "romaji table has an unknown symbol or a duplicate entry");
+    static_assert(romajiDFA.numStates < 65536, "romaji DFA states must fit in uint16_t");
+
+    char32_t lower(char32_t c) {
+        return (c >= U'A' && c <= U'Z') ? c - U'A' + U'a' : c;
+    }
+}
+
+void ofxIMERomajiComposer::input(char32_t c, std::u32string &marked) {
+    int sym = symbolOf(lower(c));
+    if (sym < 0) {
+        // Not romaji: settle what is pending and take the character as is
+        flush(marked);
+        marked += c;
+        return;
+    }
+
+    uint16_t next = romajiDFA.states[node].next[sym];
+    if (next != 0) {
+        node = next;
+        marked += lower(c);
+        pendingLength++;
+
+        // A complete entry that nothing longer starts with is emitted at once;
+        // one like "n" waits for the next key
+        const RomajiState &s = romajiDFA.states[node];
+        if (s.kanaLength > 0 && !s.hasNext) {
+            emit(marked);
+        }
+        return;
+    }
+
+    if (node != 0) {
+        // Dead end: emit the entry we stopped on ("n" + "k"), or leave the
+        // letters as typed, then start over with this key
+        if (romajiDFA.states[node].kanaLength > 0) {
+            emit(marked);
+        }
+        else {
+            reset();
+        }
+        input(c, marked);
+        return;
+    }
+
+    // A symbol that starts no entry
+    marked += lower(c);
+}
+
+void ofxIMERomajiComposer::emit(std::u32string &marked) {
+    const RomajiState &s = romajiDFA.states[node];
+    marked.resize(marked.length() - pendingLength);
+    for (int i = 0; i < s.kanaLength; ++i) {
+        char32_t k = s.kana[i];
+        if (katakana && k >= 0x3041 && k <= 0x3096) k += 0x60;
+        marked += k;
+    }
+
+    char rest = s.rest;
+    reset();
+    if (rest) input((char32_t)rest, marked);
+}
+
+void ofxIMERomajiComposer::flush(std::u32string &marked) {
+    if (node != 0 && romajiDFA.states[node].kanaLength > 0) {
+        emit(marked);
+    }
+    reset();
+}
+
+void ofxIMERomajiComposer::backspace(std::u32string &marked) {
+    if (marked.empty()) {
+        reset();
+        return;
+    }
+    marked.pop_back();
+    if (pendingLength == 0) return;
+
+    // Walk the remaining romaji again to find the state
+    pendingLength--;
+    node = 0;
+    for (size_t i = marked.length() - pendingLength; i < marked.length(); ++i) {
+        node = romajiDFA.states[node].next[symbolOf(marked[i])];
+    }
+}
+
+void ofxIMERomajiComposer::toKatakana(std::u32string &str) {
+    for (auto &c : str) {
+        if (c >= 0x3041 && c <= 0x3096) c += 0x60;
+    }
+}
+
+void ofxIMERomajiComposer::toHiragana(std::u32string &str) {
+    for (auto &c : str) {
+        if (c >= 0x30A1 && c <= 0x30F6) c -= 0x60;
+    }
+}
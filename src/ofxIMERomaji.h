@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// OSのIMEを使わずにローマ字からかなを作る（Linuxなど、OSのIMEがない環境用）
+// 1にするとkeyPressedの文字をこの変換器でmarkedTextにする
+#ifndef OFXIME_BUILTIN_COMPOSER
+#if defined(__APPLE__) || defined(WIN32)
+#define OFXIME_BUILTIN_COMPOSER 0
+#else
+#define OFXIME_BUILTIN_COMPOSER 1
+#endif
+#endif
+
+// ローマ字→かな変換器
+// 変換表（ofxIMERomaji.cpp）からコンパイル時にDFAを作り、1文字ごとに状態を1つ進める。
+// 入力途中のローマ字はmarkedの末尾にそのまま置いておき、かなが確定したら置き換える。
+// markedの容量が足りていればキー入力ごとの確保はない
+class ofxIMERomajiComposer {
+public:
+    // cを入力してmarkedを更新する（変換表にない文字はそのまま追加）
+    void input(char32_t c, std::u32string &marked);
+
+    // 末尾を1文字消す（入力途中のローマ字があればその1文字）
+    void backspace(std::u32string &marked);
+
+    // 入力途中のローマ字を確定する（"n" → "ん"、それ以外はローマ字のまま残す）
+    void flush(std::u32string &marked);
+
+    void reset() { node = 0; pendingLength = 0; }
+    bool isPending() const { return pendingLength > 0; }
+
+    // カタカナで出力する
+    void setKatakana(bool k) { katakana = k; }
+    bool isKatakana() const { return katakana; }
+
+    static void toKatakana(std::u32string &str);
+    static void toHiragana(std::u32string &str);
+
+private:
+    void emit(std::u32string &marked);
+
+    uint16_t node = 0;          // DFAの状態（0 = 初期状態）
+    uint8_t pendingLength = 0;  // markedの末尾にある入力途中のローマ字の文字数
+    bool katakana = false;
+};
@@ -0,0 +1,141 @@
+#include "ofxIMESoftwareCanvas.h"
+
+namespace {
+    // A pixel is covered when its center is inside [a, b)
+    int pixelEdge(float v) {
+        return (int)std::floor(v + 0.5f);
+    }
+
+    bool updateGoldens = false;
+}
+
+void ofxIMESoftwareCanvas::allocate(int width, int height) {
+    pixels.allocate(width, height, OF_PIXELS_RGBA);
+    pixels.set(0);
+}
+
+void ofxIMESoftwareCanvas::begin(const ofColor &background) {
+    unsigned char *p = pixels.getData();
+    size_t n = pixels.getWidth() * pixels.getHeight();
+    for (size_t i = 0; i < n; ++i, p += 4) {
+        p[0] = background.r;
+        p[1] = background.g;
+        p[2] = background.b;
+        p[3] = background.a;
+    }
+    translations.clear();
+    origin = glm::vec2(0, 0);
+    counts = Counts();
+}
+
+void ofxIMESoftwareCanvas::setColor(const ofColor &c) {
+    if (c == color) return;
+    color = c;
+    counts.stateChanges++;
+}
+
+void ofxIMESoftwareCanvas::pushTranslate(float x, float y) {
+    translations.push_back(origin);
+    origin += glm::vec2(x, y);
+    counts.stateChanges++;
+}
+
+void ofxIMESoftwareCanvas::popTranslate() {
+    if (translations.empty()) return;
+    origin = translations.back();
+    translations.pop_back();
+    counts.stateChanges++;
+}
+
+void ofxIMESoftwareCanvas::fillRect(float x0, float y0, float x1, float y1, const ofColor &c) {
+    int left = MAX(pixelEdge(x0 + origin.x), 0);
+    int right = MIN(pixelEdge(x1 + origin.x), getWidth());
+    int top = MAX(pixelEdge(y0 + origin.y), 0);
+    int bottom = MIN(pixelEdge(y1 + origin.y), getHeight());
+    for (int y = top; y < bottom; ++y) {
+        for (int x = left; x < right; ++x) {
+            blend(x, y, c, 255);
+        }
+    }
+}
+
+void ofxIMESoftwareCanvas::beginDrawCall(size_t utf8Bytes) {
+    counts.drawCalls++;
+    counts.bytesTranscoded += utf8Bytes;
+}
+
+void ofxIMESoftwareCanvas::drawGlyph(const unsigned char *coverage, int step, int stride, int width, int height, float x, float y) {
+    counts.glyphs++;
+    int left = pixelEdge(x + origin.x);
+    int top = pixelEdge(y + origin.y);
+    for (int row = MAX(-top, 0); row < height && top + row < getHeight(); ++row) {
+        const unsigned char *src = coverage + row * stride;
+        for (int col = MAX(-left, 0); col < width && left + col < getWidth(); ++col) {
+            if (src[col * step]) blend(left + col, top + row, color, src[col * step]);
+        }
+    }
+}
+
+void ofxIMESoftwareCanvas::blend(int x, int y, const ofColor &c, int coverage) {
+    // Source over, in integers so the result is the same on every machine
+    int a = c.a * coverage / 255;
+    if (a == 0) return;
+    unsigned char *d = pixels.getData() + ((size_t)y * pixels.getWidth() + x) * 4;
+    d[0] = (unsigned char)((c.r * a + d[0] * (255 - a)) / 255);
+    d[1] = (unsigned char)((c.g * a + d[1] * (255 - a)) / 255);
+    d[2] = (unsigned char)((c.b * a + d[2] * (255 - a)) / 255);
+    d[3] = (unsigned char)(a + d[3] * (255 - a) / 255);
+}
+
+size_t ofxIMESoftwareCanvas::compare(const ofPixels &a, const ofPixels &b, int tolerance) {
+    size_t n = a.getWidth() * a.getHeight();
+    if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight() ||
+        a.getNumChannels() != b.getNumChannels()) {
+        return MAX(n, b.getWidth() * b.getHeight());
+    }
+
+    size_t channels = a.getNumChannels();
+    const unsigned char *pa = a.getData();
+    const unsigned char *pb = b.getData();
+    size_t differing = 0;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < channels; ++k) {
+            if (std::abs(pa[i * channels + k] - pb[i * channels + k]) > tolerance) {
+                differing++;
+                break;
+            }
+        }
+    }
+    return differing;
+}
+
+void ofxIMESoftwareCanvas::setUpdateGoldens(bool update) {
+    updateGoldens = update;
+}
+
+bool ofxIMESoftwareCanvas::getUpdateGoldens() {
+    return updateGoldens;
+}
+
+size_t ofxIMESoftwareCanvas::compareToGolden(const of::filesystem::path &path, int tolerance) const {
+    if (updateGoldens) {
+        ofLogNotice("ofxIMESoftwareCanvas") << "writing golden image " << path.string();
+        if (!ofSaveImage(pixels, path)) {
+            ofLogError("ofxIMESoftwareCanvas") << "failed to write " << path.string();
+            return pixels.getWidth() * pixels.getHeight();
+        }
+        return 0;
+    }
+    // A missing golden is a failure, so a CI run without its images cannot pass
+    if (!ofFile::doesFileExist(path.string())) {
+        ofLogError("ofxIMESoftwareCanvas") << "no golden image " << path.string();
+        return pixels.getWidth() * pixels.getHeight();
+    }
+    ofPixels golden;
+    if (!ofLoadImage(golden, path)) {
+        ofLogError("ofxIMESoftwareCanvas") << "failed to load " << path.string();
+        return pixels.getWidth() * pixels.getHeight();
+    }
+    if (golden.getNumChannels() == 3) golden.setImageType(OF_IMAGE_COLOR_ALPHA);
+    return compare(pixels, golden, tolerance);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "ofMain.h"
+
+// GLを使わない描画先（RGBAのofPixels）
+// ofxIMESoftwareFontと組み合わせると、ofxIME::draw()のフレームがそのままここに描かれる
+// GPUのないCIで、レイアウトと描画を画像の比較（ゴールデンイメージ）で確かめ、
+// フレームごとの描画コール数・文字数などの回数で描画の重さの変化を見るためのもの
+//
+// ofxIMESoftwareCanvas canvas;
+// canvas.allocate(640, 240);
+// ofxIMESoftwareFont font;
+// font.load("NotoSansJP-Regular.otf", 20);
+// font.setTarget(&canvas);
+// ofxIME<ofxIMESoftwareFont> ime;
+// ime.setFont(&font);
+// canvas.begin(ofColor(255)); ime.draw(10, 30);
+// canvas.compareToGolden("golden/caret.png");
+class ofxIMESoftwareCanvas {
+public:
+    // 1フレーム分の回数（begin()で0に戻る）
+    struct Counts {
+        size_t drawCalls = 0;           // GLなら描画コールになるもの（装飾のメッシュ、drawString）
+        size_t glyphs = 0;              // 描いた文字
+        size_t quads = 0;               // 装飾の四角形
+        size_t stateChanges = 0;        // 色・座標の変更
+        size_t bytesTranscoded = 0;     // 描画のためにUTF-8にしてフォントに渡したバイト数
+    };
+
+    void allocate(int width, int height);
+    int getWidth() const { return (int)pixels.getWidth(); }
+    int getHeight() const { return (int)pixels.getHeight(); }
+
+    // フレームの始まり。背景で塗りつぶし、回数を0にする
+    void begin(const ofColor &background);
+    const Counts &getCounts() const { return counts; }
+
+    ofPixels &getPixels() { return pixels; }
+    const ofPixels &getPixels() const { return pixels; }
+
+    // 描画の状態。色は文字色（ofxIME::draw()の前に設定しておく。既定は黒）
+    void setColor(const ofColor &c);
+    const ofColor &getColor() const { return color; }
+    void pushTranslate(float x, float y);
+    void popTranslate();
+
+    // 四角形のまとまりを1回の描画コールとして描く（QuadはofxIMEの装飾と同じ形）
+    template<typename Quads>
+    void drawQuads(const Quads &quads) {
+        counts.drawCalls++;
+        for (auto &q : quads) {
+            fillRect(q.x0, q.y0, q.x1, q.y1, q.color);
+            counts.quads++;
+        }
+    }
+    void fillRect(float x0, float y0, float x1, float y1, const ofColor &c);
+
+    // 文字の描画（ofxIMESoftwareFontが呼ぶ）
+    // coverageは幅width・高さheightの濃さ（0-255）で、1画素ごとにstepバイト、1行ごとにstrideバイト
+    void beginDrawCall(size_t utf8Bytes);
+    void drawGlyph(const unsigned char *coverage, int step, int stride, int width, int height, float x, float y);
+
+    // 画像の比較。tolerance以上ずれたチャンネルがある画素の数を返す（大きさが違えば全画素）
+    static size_t compare(const ofPixels &a, const ofPixels &b, int tolerance = 0);
+
+    // pathの画像と比べて、違う画素の数を返す。pathがなければ失敗（全画素）
+    // setUpdateGoldens(true)の間は比べずに今の画像をpathへ書き出して0を返す
+    // （ゴールデンイメージを作る・作り直すときだけ明示的に有効にする）
+    size_t compareToGolden(const of::filesystem::path &path, int tolerance = 0) const;
+    static void setUpdateGoldens(bool update);
+    static bool getUpdateGoldens();
+
+private:
+    void blend(int x, int y, const ofColor &c, int coverage);
+
+    ofPixels pixels;
+    ofColor color = ofColor(0);
+    vector<glm::vec2> translations;
+    glm::vec2 origin = glm::vec2(0, 0);
+    Counts counts;
+};
@@ -0,0 +1,32 @@
+#include "ofxIMESoftwareFont.h"
+
+void ofxIMESoftwareFont::drawString(const string &s, float x, float y) const {
+    if (!target || !isLoaded()) return;
+
+    // One string is one draw call, as with the atlas meshes on GL
+    target->beginDrawCall(s.size());
+
+    // Pixels are written as each glyph comes, so each one is rasterized right
+    // before it is drawn: a page recycled by a later glyph of the string is
+    // no longer needed by then
+    float penX = x, penY = y;
+    for (size_t i = 0; i < s.size();) {
+        char32_t c = nextCodepoint(s, i);
+        if (c == U'\n') {
+            penX = x;
+            penY += lineHeight;
+            continue;
+        }
+        const Glyph &g = rasterized(c);
+        // Coverage is the alpha of the gray-alpha pixels
+        if (g.page >= 0) {
+            const unsigned char *src = pages[g.page]->pixels.getData() + ((size_t)g.y * pageSize + g.x) * 2 + 1;
+            target->drawGlyph(src, 2, pageSize * 2, g.width, g.height, penX + g.left, penY - g.top);
+        }
+        else if (g.page == Glyph::Large) {
+            const unsigned char *src = largeGlyphs[c].pixels.getData() + 1;
+            target->drawGlyph(src, 2, g.width * 2, g.width, g.height, penX + g.left, penY - g.top);
+        }
+        penX += g.advance;
+    }
+}
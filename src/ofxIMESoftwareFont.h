@@ -0,0 +1,21 @@
+#pragma once
+
+#include "ofxIMELazyFont.h"
+#include "ofxIMESoftwareCanvas.h"
+
+// GLを使わずに描くフォント
+// 読み込み・測定・グリフのラスタライズ（FreeType）はofxIMELazyFontと同じで、
+// drawStringはテクスチャの代わりにsetTarget()の描画先へ画素を直接書く
+// （ページに入らない大きなグリフも、描く直前にラスタライズして描く）
+// ofxIME<ofxIMESoftwareFont>のdraw()は、GLの呼び出しをすべてこの描画先に向ける
+class ofxIMESoftwareFont : public ofxIMELazyFont {
+public:
+    void setTarget(ofxIMESoftwareCanvas *canvas) { target = canvas; }
+    ofxIMESoftwareCanvas *getTarget() const { return target; }
+
+    // 描画先の今の色と座標で描く（描画先がなければ何もしない）
+    void drawString(const string &s, float x, float y) const;
+
+private:
+    ofxIMESoftwareCanvas *target = nullptr;
+};
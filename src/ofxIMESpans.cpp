@@ -0,0 +1,225 @@
+#include "ofxIMESpans.h"
+
+int ofxIMESpans::newNode(int begin, int end, const ofxIMESpanStyle &style) {
+    int n;
+    if (!freeNodes.empty()) {
+        n = freeNodes.back();
+        freeNodes.pop_back();
+    }
+    else {
+        n = (int)nodes.size();
+        nodes.emplace_back();
+    }
+
+    // xorshift for the heap priorities
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    Node &node = nodes[n];
+    node = Node();
+    node.begin = begin;
+    node.end = node.maxEnd = end;
+    node.priority = seed;
+    node.style = style;
+    return n;
+}
+
+void ofxIMESpans::freeNode(int n) {
+    idToNode[nodes[n].id] = -1;
+    freeNodes.push_back(n);
+    count--;
+}
+
+int ofxIMESpans::add(int begin, int end, const ofxIMESpanStyle &style) {
+    if (begin >= end) return -1;
+
+    int n = newNode(begin, end, style);
+    nodes[n].id = (int)idToNode.size();
+    idToNode.push_back(n);
+    count++;
+
+    root = insertNode(root, n);
+    nodes[root].parent = -1;
+    return nodes[n].id;
+}
+
+bool ofxIMESpans::remove(int id) {
+    if (id < 0 || id >= (int)idToNode.size() || idToNode[id] < 0) return false;
+    int n = idToNode[id];
+
+    // The stored begin is missing the shifts still pending in its ancestors
+    int begin = nodes[n].begin;
+    for (int p = nodes[n].parent; p >= 0; p = nodes[p].parent) {
+        begin += nodes[p].lazy;
+    }
+
+    int l, m, r;
+    split(root, begin, l, r);
+    split(r, begin + 1, m, r);
+
+    scratch.clear();
+    collect(m, scratch);
+    m = -1;
+    for (int k : scratch) {
+        if (k != n) m = merge(m, k);
+    }
+    freeNode(n);
+
+    root = merge(merge(l, m), r);
+    if (root >= 0) nodes[root].parent = -1;
+    return true;
+}
+
+void ofxIMESpans::clear() {
+    nodes.clear();
+    freeNodes.clear();
+    std::fill(idToNode.begin(), idToNode.end(), -1);
+    root = -1;
+    count = 0;
+}
+
+void ofxIMESpans::insert(int pos, int length) {
+    if (root < 0 || length <= 0) return;
+
+    // Spans from pos on move as a whole; spans across pos grow
+    int l, r;
+    split(root, pos, l, r);
+    shift(r, length);
+    clipEnds(l, pos, 0, length);
+    root = merge(l, r);
+    nodes[root].parent = -1;
+}
+
+void ofxIMESpans::erase(int begin, int end) {
+    int removed = end - begin;
+    if (root < 0 || removed <= 0) return;
+
+    int l, m, r;
+    split(root, begin, l, r);
+    split(r, end, m, r);
+
+    // After the range: move back as a whole. Before it: clip the tails.
+    shift(r, -removed);
+    clipEnds(l, begin, removed, 0);
+
+    // Starting inside it: start at begin, or vanish if nothing is left
+    scratch.clear();
+    collect(m, scratch);
+    m = -1;
+    for (int k : scratch) {
+        Node &node = nodes[k];
+        node.begin = begin;
+        node.end = MAX(begin, node.end - removed);
+        if (node.end == begin) {
+            freeNode(k);
+            continue;
+        }
+        node.left = node.right = -1;
+        node.maxEnd = node.end;
+        m = merge(m, k);
+    }
+
+    root = merge(merge(l, m), r);
+    if (root >= 0) nodes[root].parent = -1;
+}
+
+void ofxIMESpans::shift(int n, int delta) {
+    if (n < 0) return;
+    Node &node = nodes[n];
+    node.begin += delta;
+    node.end += delta;
+    node.maxEnd += delta;
+    node.lazy += delta;
+}
+
+void ofxIMESpans::push(int n) {
+    Node &node = nodes[n];
+    if (node.lazy == 0) return;
+    shift(node.left, node.lazy);
+    shift(node.right, node.lazy);
+    node.lazy = 0;
+}
+
+void ofxIMESpans::pull(int n) {
+    Node &node = nodes[n];
+    node.maxEnd = node.end;
+    if (node.left >= 0) {
+        node.maxEnd = MAX(node.maxEnd, nodes[node.left].maxEnd);
+        nodes[node.left].parent = n;
+    }
+    if (node.right >= 0) {
+        node.maxEnd = MAX(node.maxEnd, nodes[node.right].maxEnd);
+        nodes[node.right].parent = n;
+    }
+}
+
+void ofxIMESpans::split(int t, int key, int &l, int &r) {
+    if (t < 0) {
+        l = r = -1;
+        return;
+    }
+    push(t);
+    if (nodes[t].begin < key) {
+        int a, b;
+        split(nodes[t].right, key, a, b);
+        nodes[t].right = a;
+        pull(t);
+        l = t;
+        r = b;
+    }
+    else {
+        int a, b;
+        split(nodes[t].left, key, a, b);
+        nodes[t].left = b;
+        pull(t);
+        l = a;
+        r = t;
+    }
+}
+
+int ofxIMESpans::merge(int l, int r) {
+    if (l < 0) return r;
+    if (r < 0) return l;
+    if (nodes[l].priority > nodes[r].priority) {
+        push(l);
+        int right = merge(nodes[l].right, r);
+        nodes[l].right = right;
+        pull(l);
+        return l;
+    }
+    push(r);
+    int left = merge(l, nodes[r].left);
+    nodes[r].left = left;
+    pull(r);
+    return r;
+}
+
+int ofxIMESpans::insertNode(int t, int n) {
+    int l, r;
+    split(t, nodes[n].begin, l, r);
+    return merge(merge(l, n), r);
+}
+
+void ofxIMESpans::collect(int t, vector<int> &out) {
+    if (t < 0) return;
+    push(t);
+    collect(nodes[t].left, out);
+    out.push_back(t);
+    collect(nodes[t].right, out);
+    nodes[t].left = nodes[t].right = -1;
+    nodes[t].maxEnd = nodes[t].end;
+}
+
+void ofxIMESpans::clipEnds(int t, int pos, int removed, int growth) {
+    // Only subtrees reaching past pos are visited
+    if (t < 0 || nodes[t].maxEnd <= pos) return;
+    push(t);
+    clipEnds(nodes[t].left, pos, removed, growth);
+    clipEnds(nodes[t].right, pos, removed, growth);
+    Node &node = nodes[t];
+    if (node.end > pos) {
+        node.end = MAX(pos, node.end - removed) + growth;
+    }
+    pull(t);
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "ofMain.h"
+
+// 文字列の装飾
+// アルファ0の色は「指定なし」（文字色はそのまま、背景・下線は描かない）
+struct ofxIMESpanStyle {
+    ofColor color = ofColor(0, 0);
+    ofColor background = ofColor(0, 0);
+    ofColor underline = ofColor(0, 0);
+};
+
+struct ofxIMESpan {
+    int id = 0;
+    int begin = 0;      // 文書先頭からの文字数（改行は1文字）
+    int end = 0;        // 含まない
+    ofxIMESpanStyle style;
+};
+
+// 装飾範囲の集合（区間木）
+// 開始位置順のtreapで、部分木の最大終了位置を持つ。挿入・削除位置より後ろの範囲は
+// 部分木に遅延加算するので、編集のたびの移動はO(log n)
+// （編集位置をまたぐ範囲だけは個別に伸縮する）
+class ofxIMESpans {
+public:
+    // [begin, end)に装飾を付ける。重なった場合は後から付けたものが優先
+    int add(int begin, int end, const ofxIMESpanStyle &style);
+    bool remove(int id);
+    void clear();
+    size_t size() const { return count; }
+
+    // 文書の編集に合わせて動かす
+    void insert(int pos, int length);
+    void erase(int begin, int end);
+    // すべての位置を単調なfで移す（文書全体の書き換え用。O(装飾の数)）
+    // 空になった範囲は消える
+    template<typename F>
+    void remap(F &&f) {
+        scratch.clear();
+        collect(root, scratch);
+        root = -1;
+        for (int k : scratch) {
+            Node &node = nodes[k];
+            node.begin = f(node.begin);
+            node.end = f(node.end);
+            if (node.end <= node.begin) {
+                freeNode(k);
+                continue;
+            }
+            node.maxEnd = node.end;
+            root = merge(root, k);
+        }
+        if (root >= 0) nodes[root].parent = -1;
+    }
+
+    // [begin, end)と重なる範囲を開始位置順にoutへ追加する
+    template<typename Container>
+    void query(int begin, int end, Container &out) {
+        query(root, begin, end, [&](const Node &n) {
+            out.push_back({n.id, n.begin, n.end, n.style});
+        });
+    }
+
+private:
+    struct Node {
+        int id = 0;
+        int begin = 0, end = 0;
+        int maxEnd = 0;         // 部分木の最大のend
+        int lazy = 0;           // 子孫に未反映の移動量
+        uint32_t priority = 0;
+        int left = -1, right = -1, parent = -1;
+        ofxIMESpanStyle style;
+    };
+
+    int newNode(int begin, int end, const ofxIMESpanStyle &style);
+    void freeNode(int n);
+    void shift(int n, int delta);
+    void push(int n);
+    void pull(int n);
+    void split(int t, int key, int &l, int &r);     // l: begin < key
+    int merge(int l, int r);
+    int insertNode(int t, int n);
+    void collect(int t, vector<int> &out);
+    void clipEnds(int t, int pos, int removed, int growth);
+
+    template<typename F>
+    void query(int t, int begin, int end, F &&f) {
+        if (t < 0 || nodes[t].maxEnd <= begin) return;
+        push(t);
+        query(nodes[t].left, begin, end, f);
+        const Node &n = nodes[t];
+        if (n.begin >= end) return;
+        if (n.end > begin) f(n);
+        query(n.right, begin, end, f);
+    }
+
+    vector<Node> nodes;
+    vector<int> freeNodes;
+    vector<int> idToNode;
+    vector<int> scratch;
+    int root = -1;
+    size_t count = 0;
+    uint32_t seed = 2463534242u;
+};
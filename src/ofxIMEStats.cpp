@@ -0,0 +1,80 @@
+#include "ofxIMEStats.h"
+
+#include <chrono>
+#include <sstream>
+
+std::atomic<uint64_t> ofxIMEStats::transcodedToUTF8{0};
+std::atomic<uint64_t> ofxIMEStats::transcodedToUTF32{0};
+
+uint64_t ofxIMEStats::nowMicros() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+int ofxIMELatencyHistogram::bucketIndex(uint64_t micros) {
+    if (micros < subBuckets) return (int)micros;
+
+    // Highest set bit picks the power of two, the next 3 bits the sub-bucket
+    int msb = 63;
+    while (!(micros >> msb)) msb--;
+    int mantissa = (int)(micros >> (msb - 3));
+    int index = (msb - 2) * subBuckets + (mantissa - subBuckets);
+    return index < numBuckets ? index : numBuckets - 1;
+}
+
+uint64_t ofxIMELatencyHistogram::bucketUpperBound(int index) {
+    if (index < subBuckets) return index;
+    int msb = index / subBuckets + 2;
+    uint64_t mantissa = index % subBuckets + subBuckets;
+    return ((mantissa + 1) << (msb - 3)) - 1;
+}
+
+void ofxIMELatencyHistogram::add(uint64_t micros) {
+    buckets[bucketIndex(micros)]++;
+    count++;
+}
+
+void ofxIMELatencyHistogram::clear() {
+    buckets.fill(0);
+    count = 0;
+}
+
+uint64_t ofxIMELatencyHistogram::percentile(double p) const {
+    if (count == 0) return 0;
+    uint64_t rank = (uint64_t)(p * (count - 1)) + 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < numBuckets; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) return bucketUpperBound(i);
+    }
+    return bucketUpperBound(numBuckets - 1);
+}
+
+std::string ofxIMEStats::toString() const {
+    std::ostringstream ss;
+    auto timer = [&ss](const char *name, const Timer &t) {
+        ss << name << ": " << t.calls << " calls, "
+           << (t.calls ? t.totalMicros / t.calls : 0) << "us avg, "
+           << t.maxMicros << "us max\n";
+    };
+    timer("draw", draw);
+    timer("keyPressed", keyPressed);
+    timer("insertText", insertText);
+    timer("setMarkedText", setMarkedText);
+    ss << "transcoded: " << bytesTranscodedToUTF8 << "B to UTF-8, "
+       << bytesTranscodedToUTF32 << "B to UTF-32\n";
+    ss << "heap allocations: " << heapAllocations << "\n";
+    ss << "lines laid out: " << linesLaidOut << "\n";
+    ss << "decoration rebuilds: " << decorationRebuilds << "\n";
+    ss << "input latency: p50 " << inputLatencyP50 << "us, p99 " << inputLatencyP99
+       << "us (" << inputLatency.getCount() << " samples)";
+    return ss.str();
+}
+
+ofxIMEScopedTimer::ofxIMEScopedTimer(ofxIMEStats::Timer &timer)
+    : timer(timer), begin(ofxIMEStats::nowMicros()) {
+}
+
+ofxIMEScopedTimer::~ofxIMEScopedTimer() {
+    timer.add(ofxIMEStats::nowMicros() - begin);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// 計測を有効にするには OFXIME_ENABLE_STATS=1 を定義する
+// （無効時はマクロが空になり、計測コードは一切残らない）
+// ofxIMEBaseのレイアウトが変わるので、アプリとアドオンの全ソースで同じ値にすること
+#ifndef OFXIME_ENABLE_STATS
+#define OFXIME_ENABLE_STATS 0
+#endif
+
+// レイテンシのヒストグラム（マイクロ秒、2のべき乗ごとに8分割した対数バケット）
+class ofxIMELatencyHistogram {
+public:
+    void add(uint64_t micros);
+    void clear();
+
+    // p: 0-1。バケットの上端を返すので誤差は最大12.5%
+    uint64_t percentile(double p) const;
+    uint64_t getCount() const { return count; }
+
+private:
+    static constexpr int subBuckets = 8;
+    static constexpr int numBuckets = 40 * subBuckets;
+    static int bucketIndex(uint64_t micros);
+    static uint64_t bucketUpperBound(int index);
+
+    std::array<uint32_t, numBuckets> buckets{};
+    uint64_t count = 0;
+};
+
+// ofxIMEインスタンス1つ分の計測値
+struct ofxIMEStats {
+    struct Timer {
+        uint64_t calls = 0;
+        uint64_t totalMicros = 0;
+        uint64_t maxMicros = 0;
+        void add(uint64_t micros) {
+            calls++;
+            totalMicros += micros;
+            if (micros > maxMicros) maxMicros = micros;
+        }
+    };
+
+    Timer draw;
+    Timer keyPressed;
+    Timer insertText;
+    Timer setMarkedText;
+
+    // UTF32toUTF8 / UTF8toUTF32 の出力バイト数（staticな関数なのでプロセス全体の値）
+    uint64_t bytesTranscodedToUTF8 = 0;
+    uint64_t bytesTranscodedToUTF32 = 0;
+
+    uint64_t heapAllocations = 0;   // ドキュメント領域 + フレーム中のヒープ確保
+    uint64_t linesLaidOut = 0;      // draw()でレイアウトし直した行数
+    uint64_t decorationRebuilds = 0;    // 装飾のメッシュを作り直した回数
+
+    // OSからのコールバックから次のdraw()完了までの時間
+    ofxIMELatencyHistogram inputLatency;
+    uint64_t inputLatencyP50 = 0;
+    uint64_t inputLatencyP99 = 0;
+
+    // オーバーレイ表示用の複数行テキスト
+    std::string toString() const;
+
+    static uint64_t nowMicros();
+
+    // プロセス全体のトランスコード量
+    static std::atomic<uint64_t> transcodedToUTF8;
+    static std::atomic<uint64_t> transcodedToUTF32;
+};
+
+// スコープの所要時間をTimerに加算する
+class ofxIMEScopedTimer {
+public:
+    explicit ofxIMEScopedTimer(ofxIMEStats::Timer &timer);
+    ~ofxIMEScopedTimer();
+
+private:
+    ofxIMEStats::Timer &timer;
+    uint64_t begin;
+};
+
+#if OFXIME_ENABLE_STATS
+#define OFXIME_STATS(expr) expr
+#define OFXIME_STATS_SCOPE(timer) ofxIMEScopedTimer ofxIMEStatsScope(timer)
+#else
+#define OFXIME_STATS(expr)
+#define OFXIME_STATS_SCOPE(timer)
+#endif
@@ -0,0 +1,77 @@
+#include "ofxIMEThreadPool.h"
+
+ofxIMEThreadPool &ofxIMEThreadPool::get() {
+    static ofxIMEThreadPool pool;
+    return pool;
+}
+
+ofxIMEThreadPool::ofxIMEThreadPool() {
+    unsigned n = std::thread::hardware_concurrency();
+    for (unsigned i = 1; i < n; ++i) {
+        workers.emplace_back(&ofxIMEThreadPool::workerLoop, this);
+    }
+}
+
+ofxIMEThreadPool::~ofxIMEThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto &w : workers) {
+        if (w.joinable()) w.join();
+    }
+}
+
+void ofxIMEThreadPool::parallelFor(size_t n, size_t g, const std::function<void(size_t, size_t)> &f) {
+    if (n == 0) return;
+    g = MAX(g, (size_t)1);
+    if (workers.empty() || n <= g) {
+        f(0, n);
+        return;
+    }
+
+    std::lock_guard<std::mutex> call(callMutex);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &f;
+        count = n;
+        grain = g;
+        next.store(0, std::memory_order_relaxed);
+        finished = 0;
+        generation++;
+    }
+    wake.notify_all();
+
+    runChunks();
+
+    // Every worker checks in, so none can still be holding this job afterwards
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return finished == workers.size(); });
+    job = nullptr;
+}
+
+void ofxIMEThreadPool::runChunks() {
+    while (true) {
+        size_t begin = next.fetch_add(grain, std::memory_order_relaxed);
+        if (begin >= count) return;
+        (*job)(begin, MIN(begin + grain, count));
+    }
+}
+
+void ofxIMEThreadPool::workerLoop() {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+
+        runChunks();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (++finished == workers.size()) done.notify_one();
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ofMain.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+// 大きな文書を分けて処理するためのスレッドプール（プロセス共通）
+// ワーカーは (CPUのコア数 - 1) 本で、呼んだスレッドも一緒に処理する
+class ofxIMEThreadPool {
+public:
+    static ofxIMEThreadPool &get();
+
+    // [0, count)をgrain個ずつに分けてjob(begin, end)を並列に呼ぶ。全部終わるまで戻らない
+    // 同時に呼ばれた場合は順番に処理する
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)> &job);
+
+    size_t getNumThreads() const { return workers.size() + 1; }
+
+    ~ofxIMEThreadPool();
+
+private:
+    ofxIMEThreadPool();
+    void workerLoop();
+    void runChunks();
+
+    std::mutex callMutex;               // parallelForを1つずつにする
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(size_t, size_t)> *job = nullptr;
+    size_t count = 0;
+    size_t grain = 1;
+    std::atomic<size_t> next{0};        // 次に処理する位置
+    uint64_t generation = 0;            // parallelForごとに増える
+    size_t finished = 0;                // 今回の分を終えたワーカーの数
+    bool stopping = false;
+    vector<std::thread> workers;
+};
@@ -0,0 +1,102 @@
+#include "ofxIMETrace.h"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace {
+    std::atomic<bool> traceEnabled{false};
+    std::atomic<uint32_t> nextThreadId{1};
+
+    // Ring buffer shared by every instance and thread
+    std::mutex ringMutex;
+    std::vector<ofxIMETrace::Event> ring(16384);
+    uint64_t written = 0;
+
+    uint32_t currentThreadId() {
+        thread_local uint32_t id = nextThreadId++;
+        return id;
+    }
+
+    void writeEscaped(std::ostringstream &ss, const char *s) {
+        for (; *s; ++s) {
+            if (*s == '"' || *s == '\\') ss << '\\';
+            ss << *s;
+        }
+    }
+}
+
+void ofxIMETrace::setEnabled(bool enabled) {
+    traceEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool ofxIMETrace::isEnabled() {
+    return traceEnabled.load(std::memory_order_relaxed);
+}
+
+void ofxIMETrace::setBufferSize(size_t bytes) {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    size_t n = bytes / sizeof(Event);
+    ring.assign(n > 0 ? n : 1, Event{});
+    ring.shrink_to_fit();
+    written = 0;
+}
+
+size_t ofxIMETrace::getBufferSize() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    return ring.size() * sizeof(Event);
+}
+
+void ofxIMETrace::record(const char *name, uint64_t beginMicros, uint64_t durationMicros) {
+    Event e{name, beginMicros, (uint32_t)durationMicros, currentThreadId()};
+    std::lock_guard<std::mutex> lock(ringMutex);
+    ring[written % ring.size()] = e;
+    written++;
+}
+
+void ofxIMETrace::clear() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    written = 0;
+}
+
+std::string ofxIMETrace::toJSON() {
+    // Copy out under the lock, format without it
+    std::vector<Event> events;
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        size_t n = written < ring.size() ? (size_t)written : ring.size();
+        events.reserve(n);
+        for (uint64_t i = written - n; i < written; ++i) {
+            events.push_back(ring[i % ring.size()]);
+        }
+    }
+
+    std::ostringstream ss;
+    ss << "{\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); ++i) {
+        const Event &e = events[i];
+        if (i > 0) ss << ',';
+        ss << "\n{\"name\":\"";
+        writeEscaped(ss, e.name);
+        ss << "\",\"cat\":\"ofxIME\",\"ph\":\"X\",\"ts\":" << e.beginMicros
+           << ",\"dur\":" << e.durationMicros
+           << ",\"pid\":1,\"tid\":" << e.threadId << '}';
+    }
+    ss << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return ss.str();
+}
+
+bool ofxIMETrace::dump(const std::string &path) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    out << toJSON();
+    return (bool)out;
+}
+
+uint64_t ofxIMETrace::nowMicros() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 入力パイプラインのトレース（Chrome trace-event形式で書き出す）
+// keyDown → interpretKeyEvents → setMarkedText/insertText → ofxIMEBase → draw
+// の各段をスコープ単位で固定サイズのリングバッファに記録する。
+// 古いイベントから上書きされるのでメモリ使用量は一定で、常時有効にしておける。
+// oFのヘッダに依存しないので ofxIMEView.mm からも使える
+class ofxIMETrace {
+public:
+    struct Event {
+        const char *name;       // 文字列リテラルのみ（コピーしない）
+        uint64_t beginMicros;
+        uint32_t durationMicros;
+        uint32_t threadId;
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    // リングバッファのサイズ（バイト）。記録済みのイベントは破棄される
+    static void setBufferSize(size_t bytes);
+    static size_t getBufferSize();
+
+    static void record(const char *name, uint64_t beginMicros, uint64_t durationMicros);
+    static void clear();
+
+    // Perfetto / chrome://tracing で読めるJSON
+    static std::string toJSON();
+    static bool dump(const std::string &path);
+
+    static uint64_t nowMicros();
+};
+
+class ofxIMETraceScope {
+public:
+    explicit ofxIMETraceScope(const char *name)
+        : name(ofxIMETrace::isEnabled() ? name : nullptr),
+          begin(this->name ? ofxIMETrace::nowMicros() : 0) {}
+    ~ofxIMETraceScope() {
+        if (name) ofxIMETrace::record(name, begin, ofxIMETrace::nowMicros() - begin);
+    }
+
+private:
+    const char *name;
+    uint64_t begin;
+};
+
+#define OFXIME_TRACE_SCOPE(name) ofxIMETraceScope ofxIMETraceScope_(name)
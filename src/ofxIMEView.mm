@@ -3,6 +3,7 @@
 // Instead we use forward declaration and C-style callback functions
 
 #import "ofxIMEView.h"
+#include "ofxIMETrace.h"
 #include <vector>
 
 // Forward declaration - we'll use extern functions to call ofxIMEBase methods
@@ -14,6 +15,18 @@ extern "C" {
     void ofxIME_setMarkedText(ofxIMEBase* ime, const char32_t* str, size_t len, int selLoc, int selLen);
     void ofxIME_unmarkText(ofxIMEBase* ime);
     void ofxIME_getMarkedTextScreenPosition(ofxIMEBase* ime, float* x, float* y);
+    void ofxIME_insertTextUTF16(ofxIMEBase* ime, const char16_t* str, size_t len);
+    void ofxIME_setMarkedTextUTF16(ofxIMEBase* ime, const char16_t* str, size_t len, int selLoc, int selLen);
+    size_t ofxIME_getCursorOffsetUTF16(ofxIMEBase* ime);
+    void ofxIME_getSelectionUTF16(ofxIMEBase* ime, size_t* begin, size_t* end);
+    size_t ofxIME_copyRangeUTF16(ofxIMEBase* ime, size_t* begin, size_t* end, char16_t* dst, size_t capacity);
+}
+
+// The UTF-16 code units of an NSString, converted on the C++ side
+static std::vector<unichar> charactersOf(NSString *string) {
+    std::vector<unichar> chars(string.length);
+    [string getCharacters:chars.data() range:NSMakeRange(0, string.length)];
+    return chars;
 }
 
 @implementation ofxIMEView
@@ -41,12 +54,17 @@ extern "C" {
 
 // Forward key events to IME and original view
 - (void)keyDown:(NSEvent *)event {
+    OFXIME_TRACE_SCOPE("ofxIMEView keyDown");
+
     // Reset flag before processing
     _handledByIME = NO;
 
     // Let IME process the event
     // This may call insertText: or setMarkedText: which will set _handledByIME = YES
-    [self interpretKeyEvents:@[event]];
+    {
+        OFXIME_TRACE_SCOPE("interpretKeyEvents");
+        [self interpretKeyEvents:@[event]];
+    }
 
     // Only forward to original view if IME didn't handle it
     // This prevents double input (once from IME, once from oF key handler)
@@ -122,6 +140,8 @@ extern "C" {
 
 // Insert confirmed text
 - (void)insertText:(id)string replacementRange:(NSRange)replacementRange {
+    OFXIME_TRACE_SCOPE("ofxIMEView insertText");
+
     // Mark as handled by IME
     _handledByIME = YES;
 
@@ -146,21 +166,8 @@ extern "C" {
 
     // Pass confirmed text to ofxIME
     if (_imeInstance && insertString.length > 0) {
-        // Convert NSString to u32string
-        std::vector<char32_t> u32vec;
-        for (NSUInteger i = 0; i < insertString.length; ++i) {
-            unichar c = [insertString characterAtIndex:i];
-            // Handle surrogate pairs
-            if (CFStringIsSurrogateHighCharacter(c) && i + 1 < insertString.length) {
-                unichar low = [insertString characterAtIndex:++i];
-                if (CFStringIsSurrogateLowCharacter(low)) {
-                    u32vec.push_back(CFStringGetLongCharacterForSurrogatePair(c, low));
-                }
-            } else {
-                u32vec.push_back((char32_t)c);
-            }
-        }
-        ofxIME_insertText(_imeInstance, u32vec.data(), u32vec.size());
+        std::vector<unichar> chars = charactersOf(insertString);
+        ofxIME_insertTextUTF16(_imeInstance, (const char16_t*)chars.data(), chars.size());
     }
 }
 
@@ -190,6 +197,8 @@ extern "C" {
 
 // Set marked (composing) text
 - (void)setMarkedText:(id)string selectedRange:(NSRange)selectedRange replacementRange:(NSRange)replacementRange {
+    OFXIME_TRACE_SCOPE("ofxIMEView setMarkedText");
+
     // Mark as handled by IME
     _handledByIME = YES;
 
@@ -212,27 +221,17 @@ extern "C" {
 
     // Pass marked text to ofxIME
     if (_imeInstance) {
-        // Convert NSString to u32string
-        std::vector<char32_t> u32vec;
-        for (NSUInteger i = 0; i < markedString.length; ++i) {
-            unichar c = [markedString characterAtIndex:i];
-            // Handle surrogate pairs
-            if (CFStringIsSurrogateHighCharacter(c) && i + 1 < markedString.length) {
-                unichar low = [markedString characterAtIndex:++i];
-                if (CFStringIsSurrogateLowCharacter(low)) {
-                    u32vec.push_back(CFStringGetLongCharacterForSurrogatePair(c, low));
-                }
-            } else {
-                u32vec.push_back((char32_t)c);
-            }
-        }
-        ofxIME_setMarkedText(_imeInstance, u32vec.data(), u32vec.size(),
-                            (int)selectedRange.location, (int)selectedRange.length);
+        // The selection is in UTF-16 units; converted along with the text
+        std::vector<unichar> chars = charactersOf(markedString);
+        ofxIME_setMarkedTextUTF16(_imeInstance, (const char16_t*)chars.data(), chars.size(),
+                                  (int)selectedRange.location, (int)selectedRange.length);
     }
 }
 
 // Confirm marked text
 - (void)unmarkText {
+    OFXIME_TRACE_SCOPE("ofxIMEView unmarkText");
+
     _markedRange = NSMakeRange(NSNotFound, 0);
     [_markedTextStorage setAttributedString:[[NSAttributedString alloc] init]];
 
@@ -241,14 +240,28 @@ extern "C" {
     }
 }
 
+// Ranges are in UTF-16 units of the document, with the marked text at the
+// cursor; _markedRange and _selectedRange are kept relative to the marked text
+
 // Return selected range
 - (NSRange)selectedRange {
-    return _selectedRange;
+    if (!_imeInstance) {
+        return _selectedRange;
+    }
+    if ([self hasMarkedText]) {
+        return NSMakeRange(ofxIME_getCursorOffsetUTF16(_imeInstance) + _selectedRange.location, _selectedRange.length);
+    }
+    size_t begin = 0, end = 0;
+    ofxIME_getSelectionUTF16(_imeInstance, &begin, &end);
+    return NSMakeRange(begin, end - begin);
 }
 
 // Return marked text range
 - (NSRange)markedRange {
-    return _markedRange;
+    if (!_imeInstance || ![self hasMarkedText]) {
+        return _markedRange;
+    }
+    return NSMakeRange(ofxIME_getCursorOffsetUTF16(_imeInstance), _markedRange.length);
 }
 
 // Check if has marked text
@@ -258,16 +271,34 @@ extern "C" {
 
 // Return attributed substring for range
 - (nullable NSAttributedString *)attributedSubstringForProposedRange:(NSRange)range actualRange:(nullable NSRangePointer)actualRange {
-    if (_markedRange.location != NSNotFound && _markedTextStorage.length > 0) {
-        if (range.location < _markedTextStorage.length) {
-            NSRange adjustedRange = NSMakeRange(range.location, MIN(range.length, _markedTextStorage.length - range.location));
-            if (actualRange) {
-                *actualRange = adjustedRange;
-            }
-            return [_markedTextStorage attributedSubstringFromRange:adjustedRange];
+    if (!_imeInstance) {
+        return nil;
+    }
+
+    // While composing, only the marked text is served
+    if ([self hasMarkedText]) {
+        NSRange marked = [self markedRange];
+        if (range.location < marked.location || range.location >= NSMaxRange(marked)) {
+            return nil;
+        }
+        NSUInteger location = range.location - marked.location;
+        NSRange adjustedRange = NSMakeRange(location, MIN(range.length, _markedTextStorage.length - location));
+        if (actualRange) {
+            *actualRange = NSMakeRange(marked.location + adjustedRange.location, adjustedRange.length);
         }
+        return [_markedTextStorage attributedSubstringFromRange:adjustedRange];
+    }
+
+    // Committed text, written out as UTF-16 straight from the document
+    size_t begin = range.location, end = NSMaxRange(range);
+    size_t length = ofxIME_copyRangeUTF16(_imeInstance, &begin, &end, nullptr, 0);
+    std::vector<unichar> chars(length);
+    ofxIME_copyRangeUTF16(_imeInstance, &begin, &end, (char16_t*)chars.data(), chars.size());
+    if (actualRange) {
+        *actualRange = NSMakeRange(begin, end - begin);
     }
-    return nil;
+    NSString *text = [NSString stringWithCharacters:chars.data() length:chars.size()];
+    return [[NSAttributedString alloc] initWithString:text];
 }
 
 // Valid attributes for marked text
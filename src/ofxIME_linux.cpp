@@ -0,0 +1,18 @@
+// Linuxなど、OSのIMEを使わない環境の実装
+
+#if !defined(__APPLE__) && !defined(WIN32)
+
+#include "ofxIME.h"
+
+void ofxIMEBase::startIMEObserver() {
+    // 監視するOSのIMEはない
+    // OFXIME_BUILTIN_COMPOSERならkeyPressedでローマ字をかなにする
+}
+
+void ofxIMEBase::stopIMEObserver() {
+}
+
+void ofxIMEBase::syncWithSystemIME() {
+}
+
+#endif
@@ -190,6 +190,48 @@ void ofxIME_getMarkedTextScreenPosition(ofxIMEBase* ime, float* x, float* y) {
     }
 }
 
+void ofxIME_insertTextUTF16(ofxIMEBase* ime, const char16_t* str, size_t len) {
+    if (ime && str) {
+        u32string u32str;
+        ofxIMEBase::UTF16toUTF32(std::u16string_view(str, len), u32str);
+        ime->insertText(u32str);
+    }
+}
+
+void ofxIME_setMarkedTextUTF16(ofxIMEBase* ime, const char16_t* str, size_t len, int selLoc, int selLen) {
+    if (ime) {
+        u32string u32str;
+        ofxIMEBase::UTF16toUTF32(std::u16string_view(str, len), u32str);
+
+        // NSRange counts UTF-16 units; the marked text's selection is in characters
+        size_t begin = ofxIMEOffsetIndex::convert(u32str, MAX(selLoc, 0), ofxIMEOffsetIndex::UTF16, ofxIMEOffsetIndex::UTF32);
+        size_t end = ofxIMEOffsetIndex::convert(u32str, MAX(selLoc + selLen, 0), ofxIMEOffsetIndex::UTF16, ofxIMEOffsetIndex::UTF32);
+        ime->setMarkedTextFromOS(u32str, (int)begin, (int)(end - begin));
+    }
+}
+
+size_t ofxIME_getCursorOffsetUTF16(ofxIMEBase* ime) {
+    if (!ime) return 0;
+    return ime->getOffset(ime->getCursorLine(), ime->getCursorPos(), ofxIMEOffsetIndex::UTF16);
+}
+
+void ofxIME_getSelectionUTF16(ofxIMEBase* ime, size_t* begin, size_t* end) {
+    if (ime && begin && end) {
+        ime->getSelectionOffsets(ofxIMEOffsetIndex::UTF16, *begin, *end);
+    }
+}
+
+// begin and end are moved to the start of the characters they fall in
+size_t ofxIME_copyRangeUTF16(ofxIMEBase* ime, size_t* begin, size_t* end, char16_t* dst, size_t capacity) {
+    if (!ime || !begin || !end) return 0;
+    int bl, bp, el, ep;
+    ime->getPosition(*begin, ofxIMEOffsetIndex::UTF16, bl, bp);
+    ime->getPosition(MAX(*begin, *end), ofxIMEOffsetIndex::UTF16, el, ep);
+    *begin = ime->getOffset(bl, bp, ofxIMEOffsetIndex::UTF16);
+    *end = ime->getOffset(el, ep, ofxIMEOffsetIndex::UTF16);
+    return ime->copyRangeUTF16(bl, bp, el, ep, dst, capacity);
+}
+
 } // extern "C"
 
 #endif
@@ -5,20 +5,25 @@
 #include "ofxIME.h"
 #include <codecvt>
 
-void ofxIME::startIMEObserver() {
+void ofxIMEBase::startIMEObserver() {
     // 初期状態を取得
     syncWithSystemIME();
 
     // updateイベントでポーリング
-    ofAddListener(ofEvents().update, this, &ofxIME::checkIMEState);
+    ofAddListener(ofEvents().update, this, &ofxIMEBase::checkIMEState);
 }
 
-void ofxIME::stopIMEObserver() {
-    ofRemoveListener(ofEvents().update, this, &ofxIME::checkIMEState);
+void ofxIMEBase::stopIMEObserver() {
+    ofRemoveListener(ofEvents().update, this, &ofxIMEBase::checkIMEState);
 }
 
-void ofxIME::checkIMEState(ofEventArgs &args) {
-    syncWithSystemIME();
+void ofxIMEBase::checkIMEState(ofEventArgs &args) {
+    OFXIME_TRACE_SCOPE("ofxIMEBase checkIMEState");
+
+    {
+        OFXIME_TRACE_SCOPE("syncWithSystemIME");
+        syncWithSystemIME();
+    }
 
     // IMEの未確定文字列を取得
     HWND hwnd = GetForegroundWindow();
@@ -35,25 +40,14 @@ void ofxIME::checkIMEState(ofEventArgs &args) {
         ImmGetCompositionStringW(hIMC, GCS_COMPSTR, compStr, compStrLen);
         compStr[compStrLen / sizeof(wchar_t)] = L'\0';
 
-        // wstringからu32stringに変換
+        // UTF-16からu32stringに変換
         u32string u32str;
-        for (int i = 0; compStr[i] != L'\0'; ++i) {
-            wchar_t c = compStr[i];
-            // サロゲートペアの処理
-            if (c >= 0xD800 && c <= 0xDBFF && compStr[i + 1] != L'\0') {
-                wchar_t low = compStr[++i];
-                if (low >= 0xDC00 && low <= 0xDFFF) {
-                    char32_t codepoint = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
-                    u32str += codepoint;
-                }
-            } else {
-                u32str += (char32_t)c;
-            }
-        }
+        UTF16toUTF32(std::u16string_view((const char16_t*)compStr, compStrLen / sizeof(wchar_t)), u32str);
         delete[] compStr;
 
-        // カーソル位置を取得
+        // カーソル位置を取得（UTF-16単位なので文字位置にする）
         LONG cursorPos = ImmGetCompositionString(hIMC, GCS_CURSORPOS, NULL, 0);
+        cursorPos = (LONG)ofxIMEOffsetIndex::convert(u32str, MAX(cursorPos, 0L), ofxIMEOffsetIndex::UTF16, ofxIMEOffsetIndex::UTF32);
 
         // ofxIMEに未確定文字列を渡す
         setMarkedTextFromOS(u32str, cursorPos, 0);
@@ -67,9 +61,7 @@ void ofxIME::checkIMEState(ofEventArgs &args) {
                 for (DWORD i = 0; i < candList->dwCount && i < 9; ++i) {
                     wchar_t* candStr = (wchar_t*)((char*)candList + candList->dwOffset[i]);
                     u32string candU32;
-                    for (int j = 0; candStr[j] != L'\0'; ++j) {
-                        candU32 += (char32_t)candStr[j];
-                    }
+                    UTF16toUTF32((const char16_t*)candStr, candU32);
                     cands.push_back(candU32);
                 }
                 setCandidates(cands, candList->dwSelection);
@@ -88,11 +80,9 @@ void ofxIME::checkIMEState(ofEventArgs &args) {
                 ImmGetCompositionStringW(hIMC, GCS_RESULTSTR, resultStr, resultStrLen);
                 resultStr[resultStrLen / sizeof(wchar_t)] = L'\0';
 
-                // wstringからu32stringに変換
+                // UTF-16からu32stringに変換
                 u32string u32str;
-                for (int i = 0; resultStr[i] != L'\0'; ++i) {
-                    u32str += (char32_t)resultStr[i];
-                }
+                UTF16toUTF32(std::u16string_view((const char16_t*)resultStr, resultStrLen / sizeof(wchar_t)), u32str);
                 delete[] resultStr;
 
                 // 確定文字列を挿入
@@ -108,7 +98,7 @@ void ofxIME::checkIMEState(ofEventArgs &args) {
     ImmReleaseContext(hwnd, hIMC);
 }
 
-void ofxIME::syncWithSystemIME() {
+void ofxIMEBase::syncWithSystemIME() {
     // フォアグラウンドウィンドウのIMEコンテキストを取得
     HWND hwnd = GetForegroundWindow();
     if (!hwnd) return;